@@ -2,10 +2,14 @@
 #define ECG_ELLIPTIC_CURVE_H
 
 #include "field.h"
+#include "utils/field_root.h"
 #include "utils/random.h"
+#include "utils/registry.h"
 #include "utils/wnaf.h"
 
+#include <memory>
 #include <optional>
+#include <tuple>
 
 namespace elliptic_curve_guide {
     namespace elliptic_curve {
@@ -19,10 +23,11 @@ namespace elliptic_curve_guide {
         };
 
         namespace {
+            template<typename Field>
             class EllipticCurvePointConcept {
             protected:
-                using Field = field::Field;
-                using Element = field::FieldElement;
+                using Element = typename Field::Element;
+                using uint_type = typename Field::uint_type;
 
             public:
                 virtual Element get_x() const = 0;
@@ -33,9 +38,9 @@ namespace elliptic_curve_guide {
                 }
 
             protected:
-                EllipticCurvePointConcept(std::shared_ptr<const Element> a, std::shared_ptr<const Element> b,
-                                          std::shared_ptr<const Field> F, bool is_null = false) :
-                    m_a {std::move(a)}, m_b {std::move(b)}, m_field {std::move(F)}, m_is_null(is_null) {};
+                EllipticCurvePointConcept(const Element* a, const Element* b, const Field* F,
+                                          bool is_null = false) :
+                    m_a {a}, m_b {b}, m_field {F}, m_is_null(is_null) {};
 
                 virtual void negative() = 0;
                 virtual void twice() = 0;
@@ -45,135 +50,159 @@ namespace elliptic_curve_guide {
                     m_is_null = true;
                 }
 
-                std::shared_ptr<const Element> m_a;
-                std::shared_ptr<const Element> m_b;
-                std::shared_ptr<const Field> m_field;
+                const Element* m_a;
+                const Element* m_b;
+                const Field* m_field;
                 bool m_is_null;
             };
         }   // namespace
 
-        template<CoordinatesType type = CoordinatesType::Normal>
+        // Points over Field are multiplied by integers and field elements of the width of its values
+        template<typename Field>
+        using ScalarUint = typename Field::uint_type;
+
+        template<typename Field>
+        using ScalarElement = field::BasicFieldElement<ScalarUint<Field>>;
+
+        template<CoordinatesType type = CoordinatesType::Normal, typename Field = field::Field>
         class EllipticCurvePoint;
 
-        template<CoordinatesType type>
-        EllipticCurvePoint<type> operator+(const EllipticCurvePoint<type>& lhs,
-                                           const EllipticCurvePoint<type>& rhs) {
+        template<typename Field = field::Field>
+        class BasicEllipticCurve;
+
+        template<CoordinatesType type, typename Field>
+        EllipticCurvePoint<type, Field> operator+(const EllipticCurvePoint<type, Field>& lhs,
+                                                  const EllipticCurvePoint<type, Field>& rhs) {
             EllipticCurvePoint result = lhs;
             result += rhs;
             return result;
         }
 
-        template<CoordinatesType type>
-        EllipticCurvePoint<type> operator+(EllipticCurvePoint<type>&& lhs,
-                                           const EllipticCurvePoint<type>& rhs) {
+        template<CoordinatesType type, typename Field>
+        EllipticCurvePoint<type, Field> operator+(EllipticCurvePoint<type, Field>&& lhs,
+                                                  const EllipticCurvePoint<type, Field>& rhs) {
             lhs += rhs;
             return lhs;
         }
 
-        template<CoordinatesType type>
-        EllipticCurvePoint<type> operator+(const EllipticCurvePoint<type>& lhs,
-                                           EllipticCurvePoint<type>&& rhs) {
+        template<CoordinatesType type, typename Field>
+        EllipticCurvePoint<type, Field> operator+(const EllipticCurvePoint<type, Field>& lhs,
+                                                  EllipticCurvePoint<type, Field>&& rhs) {
             rhs += lhs;
             return rhs;
         }
 
-        template<CoordinatesType type>
-        EllipticCurvePoint<type> operator+(EllipticCurvePoint<type>&& lhs, EllipticCurvePoint<type>&& rhs) {
+        template<CoordinatesType type, typename Field>
+        EllipticCurvePoint<type, Field> operator+(EllipticCurvePoint<type, Field>&& lhs,
+                                                  EllipticCurvePoint<type, Field>&& rhs) {
             lhs += rhs;
             return lhs;
         }
 
-        template<CoordinatesType type>
-        EllipticCurvePoint<type> operator-(const EllipticCurvePoint<type>& lhs,
-                                           const EllipticCurvePoint<type>& rhs) {
+        template<CoordinatesType type, typename Field>
+        EllipticCurvePoint<type, Field> operator-(const EllipticCurvePoint<type, Field>& lhs,
+                                                  const EllipticCurvePoint<type, Field>& rhs) {
             EllipticCurvePoint result = lhs;
             result -= rhs;
             return result;
         }
 
-        template<CoordinatesType type>
-        EllipticCurvePoint<type> operator-(EllipticCurvePoint<type>&& lhs,
-                                           const EllipticCurvePoint<type>& rhs) {
+        template<CoordinatesType type, typename Field>
+        EllipticCurvePoint<type, Field> operator-(EllipticCurvePoint<type, Field>&& lhs,
+                                                  const EllipticCurvePoint<type, Field>& rhs) {
             lhs -= rhs;
             return lhs;
         }
 
-        template<CoordinatesType type>
-        EllipticCurvePoint<type> operator-(const EllipticCurvePoint<type>& lhs,
-                                           EllipticCurvePoint<type>&& rhs) {
+        template<CoordinatesType type, typename Field>
+        EllipticCurvePoint<type, Field> operator-(const EllipticCurvePoint<type, Field>& lhs,
+                                                  EllipticCurvePoint<type, Field>&& rhs) {
             rhs -= lhs;
             rhs = -rhs;
             return rhs;
         }
 
-        template<CoordinatesType type>
-        EllipticCurvePoint<type> operator-(EllipticCurvePoint<type>&& lhs, EllipticCurvePoint<type>&& rhs) {
+        template<CoordinatesType type, typename Field>
+        EllipticCurvePoint<type, Field> operator-(EllipticCurvePoint<type, Field>&& lhs,
+                                                  EllipticCurvePoint<type, Field>&& rhs) {
             lhs -= rhs;
             return lhs;
         }
 
-        template<CoordinatesType type>
-        EllipticCurvePoint<type> operator*(const EllipticCurvePoint<type>& point, const uint& value) {
-            EllipticCurvePoint<type> result = point;
+        template<CoordinatesType type, typename Field>
+        EllipticCurvePoint<type, Field> operator*(const EllipticCurvePoint<type, Field>& point,
+                                                  const ScalarUint<Field>& value) {
+            EllipticCurvePoint<type, Field> result = point;
             result *= value;
             return result;
         }
 
-        template<CoordinatesType type>
-        EllipticCurvePoint<type> operator*(EllipticCurvePoint<type>&& point, const uint& value) {
+        template<CoordinatesType type, typename Field>
+        EllipticCurvePoint<type, Field> operator*(EllipticCurvePoint<type, Field>&& point,
+                                                  const ScalarUint<Field>& value) {
             point *= value;
             return point;
         }
 
-        template<CoordinatesType type>
-        EllipticCurvePoint<type> operator*(const uint& value, const EllipticCurvePoint<type>& point) {
-            EllipticCurvePoint<type> result = point;
+        template<CoordinatesType type, typename Field>
+        EllipticCurvePoint<type, Field> operator*(const ScalarUint<Field>& value,
+                                                  const EllipticCurvePoint<type, Field>& point) {
+            EllipticCurvePoint<type, Field> result = point;
             result *= value;
             return result;
         }
 
-        template<CoordinatesType type>
-        EllipticCurvePoint<type> operator*(const uint& value, EllipticCurvePoint<type>&& point) {
+        template<CoordinatesType type, typename Field>
+        EllipticCurvePoint<type, Field> operator*(const ScalarUint<Field>& value,
+                                                  EllipticCurvePoint<type, Field>&& point) {
             point *= value;
             return point;
         }
 
-        template<CoordinatesType type>
-        EllipticCurvePoint<type> operator*(const EllipticCurvePoint<type>& point,
-                                           const field::FieldElement& value) {
-            EllipticCurvePoint<type> result = point;
+        template<CoordinatesType type, typename Field>
+        EllipticCurvePoint<type, Field> operator*(const EllipticCurvePoint<type, Field>& point,
+                                                  const ScalarElement<Field>& value) {
+            EllipticCurvePoint<type, Field> result = point;
             result *= value;
             return result;
         }
 
-        template<CoordinatesType type>
-        EllipticCurvePoint<type> operator*(EllipticCurvePoint<type>&& point,
-                                           const field::FieldElement& value) {
+        template<CoordinatesType type, typename Field>
+        EllipticCurvePoint<type, Field> operator*(EllipticCurvePoint<type, Field>&& point,
+                                                  const ScalarElement<Field>& value) {
             point *= value;
             return point;
         }
 
-        template<CoordinatesType type>
-        EllipticCurvePoint<type> operator*(const field::FieldElement& value,
-                                           const EllipticCurvePoint<type>& point) {
-            EllipticCurvePoint<type> result = point;
+        template<CoordinatesType type, typename Field>
+        EllipticCurvePoint<type, Field> operator*(const ScalarElement<Field>& value,
+                                                  const EllipticCurvePoint<type, Field>& point) {
+            EllipticCurvePoint<type, Field> result = point;
             result *= value;
             return result;
         }
 
-        template<CoordinatesType type>
-        EllipticCurvePoint<type> operator*(const field::FieldElement& value,
-                                           EllipticCurvePoint<type>&& point) {
+        template<CoordinatesType type, typename Field>
+        EllipticCurvePoint<type, Field> operator*(const ScalarElement<Field>& value,
+                                                  EllipticCurvePoint<type, Field>&& point) {
             point *= value;
             return point;
         }
 
-        template<>
-        class EllipticCurvePoint<CoordinatesType::Normal> : public EllipticCurvePointConcept {
+        template<typename Field>
+        class EllipticCurvePoint<CoordinatesType::Normal, Field> : public EllipticCurvePointConcept<Field> {
         private:
-            friend class EllipticCurve;
+            using Base = EllipticCurvePointConcept<Field>;
+            using typename Base::Element;
+            using typename Base::uint_type;
+            using Base::m_a;
+            using Base::m_b;
+            using Base::m_field;
+            using Base::m_is_null;
+
+            friend class BasicEllipticCurve<Field>;
             friend EllipticCurvePoint algorithm::wnaf_addition<EllipticCurvePoint>(EllipticCurvePoint value,
-                                                                                   const uint& n);
+                                                                                   const uint_type& n);
 
         public:
             friend bool operator==(const EllipticCurvePoint& lhs, const EllipticCurvePoint& rhs) {
@@ -204,7 +233,7 @@ namespace elliptic_curve_guide {
                 }
 
                 const Element k = (other.m_y - m_y) / (other.m_x - m_x);
-                const Element x = Element::pow(k, 2) - m_x - other.m_x;
+                const Element x = Element::square(k) - m_x - other.m_x;
                 m_y = k * (m_x - x) - m_y;
                 m_x = x;
 
@@ -224,12 +253,12 @@ namespace elliptic_curve_guide {
                 return *this += other;
             }
 
-            EllipticCurvePoint& operator*=(const uint& value) {
+            EllipticCurvePoint& operator*=(const uint_type& value) {
                 *this = algorithm::wnaf_addition<EllipticCurvePoint>(*this, value);
                 return *this;
             }
 
-            EllipticCurvePoint& operator*=(const field::FieldElement& element) {
+            EllipticCurvePoint& operator*=(const ScalarElement<Field>& element) {
                 *this = algorithm::wnaf_addition<EllipticCurvePoint>(*this, element.value());
                 return *this;
             }
@@ -243,11 +272,7 @@ namespace elliptic_curve_guide {
             }
 
         private:
-            static EllipticCurvePoint null_point(std::shared_ptr<const Element> a,
-                                                 std::shared_ptr<const Element>
-                                                     b,
-                                                 std::shared_ptr<const Field>
-                                                     F) {
+            static EllipticCurvePoint null_point(const Element* a, const Element* b, const Field* F) {
                 return EllipticCurvePoint(F->element(0), F->element(1), a, b, F, true);
             }
 
@@ -255,10 +280,9 @@ namespace elliptic_curve_guide {
                 return point.null_point();
             }
 
-            EllipticCurvePoint(const Element& x, const Element& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(const Element& x, const Element& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_x {x},
                 m_y {y} {
                 assert(
@@ -266,10 +290,9 @@ namespace elliptic_curve_guide {
                     && "EllipticCurvePoint<CoordinatesType::Normal>::EllipticCurvePoint : invalid coordinates");
             }
 
-            EllipticCurvePoint(Element&& x, const Element& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(Element&& x, const Element& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_x {std::move(x)},
                 m_y {y} {
                 assert(
@@ -277,10 +300,9 @@ namespace elliptic_curve_guide {
                     && "EllipticCurvePoint<CoordinatesType::Normal>::EllipticCurvePoint : invalid coordinates");
             }
 
-            EllipticCurvePoint(const Element& x, Element&& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(const Element& x, Element&& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_x {x},
                 m_y {std::move(y)} {
                 assert(
@@ -288,10 +310,9 @@ namespace elliptic_curve_guide {
                     && "EllipticCurvePoint<CoordinatesType::Normal>::EllipticCurvePoint : invalid coordinates");
             }
 
-            EllipticCurvePoint(Element&& x, Element&& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(Element&& x, Element&& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_x {std::move(x)},
                 m_y {std::move(y)} {
                 assert(
@@ -317,8 +338,8 @@ namespace elliptic_curve_guide {
                     return;
                 }
 
-                const Element k = (m_field->element(3) * Element::pow(m_x, 2) + *m_a) / (m_y << 1);
-                const Element x = Element::pow(k, 2) - (m_x << 1);
+                const Element k = (m_field->element(3) * Element::square(m_x) + *m_a) / (m_y << 1);
+                const Element x = Element::square(k) - (m_x << 1);
                 m_y = k * (m_x - x) - m_y;
                 m_x = x;
                 assert(is_valid()
@@ -330,8 +351,8 @@ namespace elliptic_curve_guide {
                     return true;
                 }
 
-                const Element lhs = Element::pow(m_y, 2);
-                const Element rhs = Element::pow(m_x, 3) + *m_a * m_x + *m_b;
+                const Element lhs = Element::square(m_y);
+                const Element rhs = Element::cube(m_x) + *m_a * m_x + *m_b;
                 return lhs == rhs;
             }
 
@@ -339,12 +360,21 @@ namespace elliptic_curve_guide {
             Element m_y;
         };
 
-        template<>
-        class EllipticCurvePoint<CoordinatesType::Projective> : public EllipticCurvePointConcept {
+        template<typename Field>
+        class EllipticCurvePoint<CoordinatesType::Projective, Field>
+            : public EllipticCurvePointConcept<Field> {
         private:
-            friend class EllipticCurve;
+            using Base = EllipticCurvePointConcept<Field>;
+            using typename Base::Element;
+            using typename Base::uint_type;
+            using Base::m_a;
+            using Base::m_b;
+            using Base::m_field;
+            using Base::m_is_null;
+
+            friend class BasicEllipticCurve<Field>;
             friend EllipticCurvePoint algorithm::wnaf_addition<EllipticCurvePoint>(EllipticCurvePoint value,
-                                                                                   const uint& n);
+                                                                                   const uint_type& n);
 
         public:
             friend bool operator==(const EllipticCurvePoint& lhs, const EllipticCurvePoint& rhs) {
@@ -385,10 +415,10 @@ namespace elliptic_curve_guide {
 
                 const Element u = Y2Z1 - Y1Z2;
                 const Element v = X2Z1 - X1Z2;
-                const Element v2 = Element::pow(v, 2);
+                const Element v2 = Element::square(v);
                 const Element v3 = v2 * v;
                 const Element Z1Z2 = m_Z * other.m_Z;
-                const Element A = Element::pow(u, 2) * Z1Z2 - v3 - ((v2 * X1Z2) << 1);
+                const Element A = Element::square(u) * Z1Z2 - v3 - ((v2 * X1Z2) << 1);
 
                 m_X = v * A;
                 m_Y = u * (v2 * X1Z2 - A) - v3 * Y1Z2;
@@ -411,12 +441,12 @@ namespace elliptic_curve_guide {
                 return *this += other;
             }
 
-            EllipticCurvePoint& operator*=(const uint& value) {
+            EllipticCurvePoint& operator*=(const uint_type& value) {
                 *this = algorithm::wnaf_addition<EllipticCurvePoint>(*this, value);
                 return *this;
             }
 
-            EllipticCurvePoint& operator*=(const field::FieldElement& element) {
+            EllipticCurvePoint& operator*=(const ScalarElement<Field>& element) {
                 *this = algorithm::wnaf_addition<EllipticCurvePoint>(*this, element.value());
                 return *this;
             }
@@ -430,18 +460,13 @@ namespace elliptic_curve_guide {
             }
 
         private:
-            static EllipticCurvePoint null_point(std::shared_ptr<const Element> a,
-                                                 std::shared_ptr<const Element>
-                                                     b,
-                                                 std::shared_ptr<const Field>
-                                                     F) {
+            static EllipticCurvePoint null_point(const Element* a, const Element* b, const Field* F) {
                 return EllipticCurvePoint(F->element(0), F->element(1), a, b, F, true);
             }
 
-            EllipticCurvePoint(const Element& x, const Element& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(const Element& x, const Element& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_X {x},
                 m_Y {y},
                 m_Z {m_field->element(1)} {
@@ -450,10 +475,9 @@ namespace elliptic_curve_guide {
                     && "EllipticCurvePoint<CoordinatesType::Projective>::EllipticCurvePoint : invalid coordinates");
             }
 
-            EllipticCurvePoint(Element&& x, const Element& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(Element&& x, const Element& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_X {std::move(x)},
                 m_Y {y},
                 m_Z {m_field->element(1)} {
@@ -462,10 +486,9 @@ namespace elliptic_curve_guide {
                     && "EllipticCurvePoint<CoordinatesType::Projective>::EllipticCurvePoint : invalid coordinates");
             }
 
-            EllipticCurvePoint(const Element& x, Element&& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(const Element& x, Element&& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_X {x},
                 m_Y {std::move(y)},
                 m_Z {m_field->element(1)} {
@@ -474,10 +497,9 @@ namespace elliptic_curve_guide {
                     && "EllipticCurvePoint<CoordinatesType::Projective>::EllipticCurvePoint : invalid coordinates");
             }
 
-            EllipticCurvePoint(Element&& x, Element&& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(Element&& x, Element&& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_X {std::move(x)},
                 m_Y {std::move(y)},
                 m_Z {m_field->element(1)} {
@@ -504,14 +526,14 @@ namespace elliptic_curve_guide {
                     return;
                 }
 
-                const Element w = *m_a * Element::pow(m_Z, 2) + m_field->element(3) * Element::pow(m_X, 2);
+                const Element w = *m_a * Element::square(m_Z) + m_field->element(3) * Element::square(m_X);
                 const Element s = m_Y * m_Z;
-                const Element s2 = Element::pow(s, 2);
+                const Element s2 = Element::square(s);
                 const Element s3 = s2 * s;
                 const Element B = m_X * m_Y * s;
-                const Element h = Element::pow(w, 2) - (B << 3);
+                const Element h = Element::square(w) - (B << 3);
                 m_X = (h * s) << 1;
-                m_Y = w * ((B << 2) - h) - ((Element::pow(m_Y, 2) * s2) << 3);
+                m_Y = w * ((B << 2) - h) - ((Element::square(m_Y) * s2) << 3);
                 m_Z = s3 << 3;
                 assert(is_valid()
                        && "EllipticCurvePoint<CoordinatesType::Projective>::twice : invalid coordinates");
@@ -522,10 +544,10 @@ namespace elliptic_curve_guide {
                     return true;
                 }
 
-                const Element Z2 = Element::pow(m_Z, 2);
+                const Element Z2 = Element::square(m_Z);
                 const Element Z3 = m_Z * Z2;
-                const Element lhs = Element::pow(m_Y, 2) * m_Z;
-                const Element rhs = Element::pow(m_X, 3) + *m_a * m_X * Z2 + *m_b * Z3;
+                const Element lhs = Element::square(m_Y) * m_Z;
+                const Element rhs = Element::cube(m_X) + *m_a * m_X * Z2 + *m_b * Z3;
                 return lhs == rhs;
             }
 
@@ -534,19 +556,28 @@ namespace elliptic_curve_guide {
             Element m_Z;
         };
 
-        template<>
-        class EllipticCurvePoint<CoordinatesType::Jacobi> : public EllipticCurvePointConcept {
+        template<typename Field>
+        class EllipticCurvePoint<CoordinatesType::Jacobi, Field> : public EllipticCurvePointConcept<Field> {
         private:
-            friend class EllipticCurve;
+            using Base = EllipticCurvePointConcept<Field>;
+            using typename Base::Element;
+            using typename Base::uint_type;
+            using Accumulator = typename Element::Accumulator;
+            using Base::m_a;
+            using Base::m_b;
+            using Base::m_field;
+            using Base::m_is_null;
+
+            friend class BasicEllipticCurve<Field>;
             friend EllipticCurvePoint algorithm::wnaf_addition<EllipticCurvePoint>(EllipticCurvePoint value,
-                                                                                   const uint& n);
+                                                                                   const uint_type& n);
 
         public:
             friend bool operator==(const EllipticCurvePoint& lhs, const EllipticCurvePoint& rhs) {
-                const Element X1Z2 = lhs.m_X * Element::pow(rhs.m_Z, 2);
-                const Element X2Z1 = rhs.m_X * Element::pow(lhs.m_Z, 2);
-                const Element Y1Z2 = lhs.m_Y * Element::pow(rhs.m_Z, 3);
-                const Element Y2Z1 = rhs.m_Y * Element::pow(lhs.m_Z, 3);
+                const Element X1Z2 = lhs.m_X * Element::square(rhs.m_Z);
+                const Element X2Z1 = rhs.m_X * Element::square(lhs.m_Z);
+                const Element Y1Z2 = lhs.m_Y * Element::cube(rhs.m_Z);
+                const Element Y2Z1 = rhs.m_Y * Element::cube(lhs.m_Z);
                 return (lhs.m_is_null && rhs.m_is_null) || (X1Z2 == X2Z1 && Y1Z2 == Y2Z1);
             }
 
@@ -563,10 +594,10 @@ namespace elliptic_curve_guide {
                     return *this;
                 }
 
-                const Element X1Z2 = m_X * Element::pow(other.m_Z, 2);
-                const Element X2Z1 = other.m_X * Element::pow(m_Z, 2);
-                const Element Y1Z2 = m_Y * Element::pow(other.m_Z, 3);
-                const Element Y2Z1 = other.m_Y * Element::pow(m_Z, 3);
+                const Element X1Z2 = m_X * Element::square(other.m_Z);
+                const Element X2Z1 = other.m_X * Element::square(m_Z);
+                const Element Y1Z2 = m_Y * Element::cube(other.m_Z);
+                const Element Y2Z1 = other.m_Y * Element::cube(m_Z);
 
                 if (X1Z2 == X2Z1) {
                     if (Y1Z2 != Y2Z1) {
@@ -579,12 +610,14 @@ namespace elliptic_curve_guide {
                 }
 
                 const Element H = X2Z1 - X1Z2;
-                const Element H2 = Element::pow(H, 2);
+                const Element H2 = Element::square(H);
                 const Element H3 = H2 * H;
                 const Element r = Y2Z1 - Y1Z2;
 
-                m_X = -H3 - ((X1Z2 * H2) << 1) + Element::pow(r, 2);
-                m_Y = -Y1Z2 * H3 + r * (X1Z2 * H2 - m_X);
+                const Element U = X1Z2 * H2;
+
+                m_X = -H3 - (U << 1) + Element::square(r);
+                m_Y = Accumulator(r, U - m_X).subtract_product(Y1Z2, H3).reduce();
                 m_Z = m_Z * other.m_Z * H;
 
                 assert(is_valid()
@@ -603,37 +636,32 @@ namespace elliptic_curve_guide {
                 return *this += other;
             }
 
-            EllipticCurvePoint& operator*=(const uint& value) {
+            EllipticCurvePoint& operator*=(const uint_type& value) {
                 *this = algorithm::wnaf_addition<EllipticCurvePoint>(*this, value);
                 return *this;
             }
 
-            EllipticCurvePoint& operator*=(const field::FieldElement& element) {
+            EllipticCurvePoint& operator*=(const ScalarElement<Field>& element) {
                 *this = algorithm::wnaf_addition<EllipticCurvePoint>(*this, element.value());
                 return *this;
             }
 
             Element get_x() const final {
-                return m_X / Element::pow(m_Z, 2);
+                return m_X / Element::square(m_Z);
             }
 
             Element get_y() const final {
-                return m_Y / Element::pow(m_Z, 3);
+                return m_Y / Element::cube(m_Z);
             }
 
         private:
-            static EllipticCurvePoint null_point(std::shared_ptr<const Element> a,
-                                                 std::shared_ptr<const Element>
-                                                     b,
-                                                 std::shared_ptr<const Field>
-                                                     F) {
+            static EllipticCurvePoint null_point(const Element* a, const Element* b, const Field* F) {
                 return EllipticCurvePoint(F->element(0), F->element(1), a, b, F, true);
             }
 
-            EllipticCurvePoint(const Element& x, const Element& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(const Element& x, const Element& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_X {x},
                 m_Y {y},
                 m_Z {m_field->element(1)} {
@@ -642,10 +670,9 @@ namespace elliptic_curve_guide {
                     && "EllipticCurvePoint<CoordinatesType::Jacobi>::EllipticCurvePoint : invalid coordinates");
             }
 
-            EllipticCurvePoint(Element&& x, const Element& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(Element&& x, const Element& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_X {std::move(x)},
                 m_Y {y},
                 m_Z {m_field->element(1)} {
@@ -654,10 +681,9 @@ namespace elliptic_curve_guide {
                     && "EllipticCurvePoint<CoordinatesType::Jacobi>::EllipticCurvePoint : invalid coordinates");
             }
 
-            EllipticCurvePoint(const Element& x, Element&& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(const Element& x, Element&& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_X {x},
                 m_Y {std::move(y)},
                 m_Z {m_field->element(1)} {
@@ -666,10 +692,9 @@ namespace elliptic_curve_guide {
                     && "EllipticCurvePoint<CoordinatesType::Jacobi>::EllipticCurvePoint : invalid coordinates");
             }
 
-            EllipticCurvePoint(Element&& x, Element&& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(Element&& x, Element&& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_X {std::move(x)},
                 m_Y {std::move(y)},
                 m_Z {m_field->element(1)} {
@@ -696,13 +721,14 @@ namespace elliptic_curve_guide {
                     return;
                 }
 
-                const Element Y2 = Element::pow(m_Y, 2);
-                const Element Y4 = Element::pow(Y2, 2);
+                const Element Y2 = Element::square(m_Y);
                 const Element V = (m_X * Y2) << 2;
-                const Element W = m_field->element(3) * Element::pow(m_X, 2) + *m_a * Element::pow(m_Z, 4);
-                m_X = -(V << 1) + Element::pow(W, 2);
+                const Element W = Accumulator(m_X, m_X + m_X + m_X)
+                                      .add_product(*m_a, Element::square(Element::square(m_Z)))
+                                      .reduce();
+                m_X = -(V << 1) + Element::square(W);
                 m_Z = (m_Y * m_Z) << 1;
-                m_Y = -(Y4 << 3) + W * (V - m_X);
+                m_Y = Accumulator(W, V - m_X).subtract_product(Y2, Y2 << 3).reduce();
                 assert(is_valid()
                        && "EllipticCurvePoint<CoordinatesType::Jacobi>::twice : invalid coordinates");
             }
@@ -712,11 +738,11 @@ namespace elliptic_curve_guide {
                     return true;
                 }
 
-                const Element Z2 = Element::pow(m_Z, 2);
-                const Element Z4 = Element::pow(Z2, 2);
+                const Element Z2 = Element::square(m_Z);
+                const Element Z4 = Element::square(Z2);
                 const Element Z6 = Z4 * Z2;
-                const Element value = Element::pow(m_X, 3) + *m_a * m_X * Z4 + *m_b * Z6;
-                return Element::pow(m_Y, 2) == value;
+                const Element value = Element::cube(m_X) + *m_a * m_X * Z4 + *m_b * Z6;
+                return Element::square(m_Y) == value;
             }
 
             Element m_X;
@@ -724,12 +750,22 @@ namespace elliptic_curve_guide {
             Element m_Z;
         };
 
-        template<>
-        class EllipticCurvePoint<CoordinatesType::JacobiChudnovski> : public EllipticCurvePointConcept {
+        template<typename Field>
+        class EllipticCurvePoint<CoordinatesType::JacobiChudnovski, Field>
+            : public EllipticCurvePointConcept<Field> {
         private:
-            friend class EllipticCurve;
+            using Base = EllipticCurvePointConcept<Field>;
+            using typename Base::Element;
+            using typename Base::uint_type;
+            using Accumulator = typename Element::Accumulator;
+            using Base::m_a;
+            using Base::m_b;
+            using Base::m_field;
+            using Base::m_is_null;
+
+            friend class BasicEllipticCurve<Field>;
             friend EllipticCurvePoint algorithm::wnaf_addition<EllipticCurvePoint>(EllipticCurvePoint value,
-                                                                                   const uint& n);
+                                                                                   const uint_type& n);
 
         public:
             friend bool operator==(const EllipticCurvePoint& lhs, const EllipticCurvePoint& rhs) {
@@ -769,14 +805,16 @@ namespace elliptic_curve_guide {
                 }
 
                 const Element H = X2Z1 - X1Z2;
-                const Element H2 = Element::pow(H, 2);
+                const Element H2 = Element::square(H);
                 const Element H3 = H2 * H;
                 const Element r = Y2Z1 - Y1Z2;
 
-                m_X = -H3 - ((X1Z2 * H2) << 1) + Element::pow(r, 2);
-                m_Y = -Y1Z2 * H3 + r * (X1Z2 * H2 - m_X);
+                const Element U = X1Z2 * H2;
+
+                m_X = -H3 - (U << 1) + Element::square(r);
+                m_Y = Accumulator(r, U - m_X).subtract_product(Y1Z2, H3).reduce();
                 m_Z = m_Z * other.m_Z * H;
-                m_Z2 = Element::pow(m_Z, 2);
+                m_Z2 = Element::square(m_Z);
                 m_Z3 = m_Z * m_Z2;
 
                 assert(
@@ -796,12 +834,12 @@ namespace elliptic_curve_guide {
                 return *this += other;
             }
 
-            EllipticCurvePoint& operator*=(const uint& value) {
+            EllipticCurvePoint& operator*=(const uint_type& value) {
                 *this = algorithm::wnaf_addition<EllipticCurvePoint>(*this, value);
                 return *this;
             }
 
-            EllipticCurvePoint& operator*=(const field::FieldElement& element) {
+            EllipticCurvePoint& operator*=(const ScalarElement<Field>& element) {
                 *this = algorithm::wnaf_addition<EllipticCurvePoint>(*this, element.value());
                 return *this;
             }
@@ -815,18 +853,13 @@ namespace elliptic_curve_guide {
             }
 
         private:
-            static EllipticCurvePoint null_point(std::shared_ptr<const Element> a,
-                                                 std::shared_ptr<const Element>
-                                                     b,
-                                                 std::shared_ptr<const Field>
-                                                     F) {
+            static EllipticCurvePoint null_point(const Element* a, const Element* b, const Field* F) {
                 return EllipticCurvePoint(F->element(0), F->element(1), a, b, F, true);
             }
 
-            EllipticCurvePoint(const Element& x, const Element& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(const Element& x, const Element& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_X {x},
                 m_Y {y},
                 m_Z {m_field->element(1)},
@@ -837,10 +870,9 @@ namespace elliptic_curve_guide {
                     && "EllipticCurvePoint<CoordinatesType::JacobiChudnovski>::EllipticCurvePoint : invalid coordinates");
             }
 
-            EllipticCurvePoint(Element&& x, const Element& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(Element&& x, const Element& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_X {std::move(x)},
                 m_Y {y},
                 m_Z {m_field->element(1)},
@@ -851,10 +883,9 @@ namespace elliptic_curve_guide {
                     && "EllipticCurvePoint<CoordinatesType::JacobiChudnovski>::EllipticCurvePoint : invalid coordinates");
             }
 
-            EllipticCurvePoint(const Element& x, Element&& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(const Element& x, Element&& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_X {x},
                 m_Y {std::move(y)},
                 m_Z {m_field->element(1)},
@@ -865,10 +896,9 @@ namespace elliptic_curve_guide {
                     && "EllipticCurvePoint<CoordinatesType::JacobiChudnovski>::EllipticCurvePoint : invalid coordinates");
             }
 
-            EllipticCurvePoint(Element&& x, Element&& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(Element&& x, Element&& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_X {std::move(x)},
                 m_Y {std::move(y)},
                 m_Z {m_field->element(1)},
@@ -897,14 +927,15 @@ namespace elliptic_curve_guide {
                     return;
                 }
 
-                const Element Y2 = Element::pow(m_Y, 2);
-                const Element Y4 = Element::pow(Y2, 2);
+                const Element Y2 = Element::square(m_Y);
                 const Element V = (m_X * Y2) << 2;
-                const Element W = m_field->element(3) * Element::pow(m_X, 2) + *m_a * Element::pow(m_Z2, 2);
-                m_X = -(V << 1) + Element::pow(W, 2);
+                const Element W = Accumulator(m_X, m_X + m_X + m_X)
+                                      .add_product(*m_a, Element::square(m_Z2))
+                                      .reduce();
+                m_X = -(V << 1) + Element::square(W);
                 m_Z = (m_Y * m_Z) << 1;
-                m_Y = -(Y4 << 3) + W * (V - m_X);
-                m_Z2 = Element::pow(m_Z, 2);
+                m_Y = Accumulator(W, V - m_X).subtract_product(Y2, Y2 << 3).reduce();
+                m_Z2 = Element::square(m_Z);
                 m_Z3 = m_Z * m_Z2;
                 assert(
                     is_valid()
@@ -916,10 +947,10 @@ namespace elliptic_curve_guide {
                     return true;
                 }
 
-                const Element Z4 = Element::pow(m_Z2, 2);
-                const Element Z6 = Element::pow(m_Z3, 2);
-                const Element value = Element::pow(m_X, 3) + *m_a * m_X * Z4 + *m_b * Z6;
-                return Element::pow(m_Y, 2) == value;
+                const Element Z4 = Element::square(m_Z2);
+                const Element Z6 = Element::square(m_Z3);
+                const Element value = Element::cube(m_X) + *m_a * m_X * Z4 + *m_b * Z6;
+                return Element::square(m_Y) == value;
             }
 
             Element m_X;
@@ -929,19 +960,29 @@ namespace elliptic_curve_guide {
             Element m_Z3;
         };
 
-        template<>
-        class EllipticCurvePoint<CoordinatesType::ModifiedJacobi> : public EllipticCurvePointConcept {
+        template<typename Field>
+        class EllipticCurvePoint<CoordinatesType::ModifiedJacobi, Field>
+            : public EllipticCurvePointConcept<Field> {
         private:
-            friend class EllipticCurve;
+            using Base = EllipticCurvePointConcept<Field>;
+            using typename Base::Element;
+            using typename Base::uint_type;
+            using Accumulator = typename Element::Accumulator;
+            using Base::m_a;
+            using Base::m_b;
+            using Base::m_field;
+            using Base::m_is_null;
+
+            friend class BasicEllipticCurve<Field>;
             friend EllipticCurvePoint algorithm::wnaf_addition<EllipticCurvePoint>(EllipticCurvePoint value,
-                                                                                   const uint& n);
+                                                                                   const uint_type& n);
 
         public:
             friend bool operator==(const EllipticCurvePoint& lhs, const EllipticCurvePoint& rhs) {
-                const Element X1Z2 = lhs.m_X * Element::pow(rhs.m_Z, 2);
-                const Element X2Z1 = rhs.m_X * Element::pow(lhs.m_Z, 2);
-                const Element Y1Z2 = lhs.m_Y * Element::pow(rhs.m_Z, 3);
-                const Element Y2Z1 = rhs.m_Y * Element::pow(lhs.m_Z, 3);
+                const Element X1Z2 = lhs.m_X * Element::square(rhs.m_Z);
+                const Element X2Z1 = rhs.m_X * Element::square(lhs.m_Z);
+                const Element Y1Z2 = lhs.m_Y * Element::cube(rhs.m_Z);
+                const Element Y2Z1 = rhs.m_Y * Element::cube(lhs.m_Z);
                 return (lhs.m_is_null && rhs.m_is_null) || (X1Z2 == X2Z1 && Y1Z2 == Y2Z1);
             }
 
@@ -958,10 +999,10 @@ namespace elliptic_curve_guide {
                     return *this;
                 }
 
-                const Element X1Z2 = m_X * Element::pow(other.m_Z, 2);
-                const Element X2Z1 = other.m_X * Element::pow(m_Z, 2);
-                const Element Y1Z2 = m_Y * Element::pow(other.m_Z, 3);
-                const Element Y2Z1 = other.m_Y * Element::pow(m_Z, 3);
+                const Element X1Z2 = m_X * Element::square(other.m_Z);
+                const Element X2Z1 = other.m_X * Element::square(m_Z);
+                const Element Y1Z2 = m_Y * Element::cube(other.m_Z);
+                const Element Y2Z1 = other.m_Y * Element::cube(m_Z);
 
                 if (X1Z2 == X2Z1) {
                     if (Y1Z2 != Y2Z1) {
@@ -974,14 +1015,16 @@ namespace elliptic_curve_guide {
                 }
 
                 const Element H = X2Z1 - X1Z2;
-                const Element H2 = Element::pow(H, 2);
+                const Element H2 = Element::square(H);
                 const Element H3 = H2 * H;
                 const Element r = Y2Z1 - Y1Z2;
 
-                m_X = -H3 - ((X1Z2 * H2) << 1) + Element::pow(r, 2);
-                m_Y = -Y1Z2 * H3 + r * (X1Z2 * H2 - m_X);
+                const Element U = X1Z2 * H2;
+
+                m_X = -H3 - (U << 1) + Element::square(r);
+                m_Y = Accumulator(r, U - m_X).subtract_product(Y1Z2, H3).reduce();
                 m_Z = m_Z * other.m_Z * H;
-                m_aZ4 = *m_a * Element::pow(m_Z, 4);
+                m_aZ4 = *m_a * Element::square(Element::square(m_Z));
 
                 assert(
                     is_valid()
@@ -1000,37 +1043,32 @@ namespace elliptic_curve_guide {
                 return *this += other;
             }
 
-            EllipticCurvePoint& operator*=(const uint& value) {
+            EllipticCurvePoint& operator*=(const uint_type& value) {
                 *this = algorithm::wnaf_addition<EllipticCurvePoint>(*this, value);
                 return *this;
             }
 
-            EllipticCurvePoint& operator*=(const field::FieldElement& element) {
+            EllipticCurvePoint& operator*=(const ScalarElement<Field>& element) {
                 *this = algorithm::wnaf_addition<EllipticCurvePoint>(*this, element.value());
                 return *this;
             }
 
             Element get_x() const final {
-                return m_X / Element::pow(m_Z, 2);
+                return m_X / Element::square(m_Z);
             }
 
             Element get_y() const final {
-                return m_Y / Element::pow(m_Z, 3);
+                return m_Y / Element::cube(m_Z);
             }
 
         private:
-            static EllipticCurvePoint null_point(std::shared_ptr<const Element> a,
-                                                 std::shared_ptr<const Element>
-                                                     b,
-                                                 std::shared_ptr<const Field>
-                                                     F) {
+            static EllipticCurvePoint null_point(const Element* a, const Element* b, const Field* F) {
                 return EllipticCurvePoint(F->element(0), F->element(1), a, b, F, true);
             }
 
-            EllipticCurvePoint(const Element& x, const Element& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(const Element& x, const Element& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_X {x},
                 m_Y {y},
                 m_Z {m_field->element(1)},
@@ -1040,10 +1078,9 @@ namespace elliptic_curve_guide {
                     && "EllipticCurvePoint<CoordinatesType::ModifiedJacobi>::EllipticCurvePoint : invalid coordinates");
             }
 
-            EllipticCurvePoint(Element&& x, const Element& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(Element&& x, const Element& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_X {std::move(x)},
                 m_Y {y},
                 m_Z {m_field->element(1)},
@@ -1053,10 +1090,9 @@ namespace elliptic_curve_guide {
                     && "EllipticCurvePoint<CoordinatesType::ModifiedJacobi>::EllipticCurvePoint : invalid coordinates");
             }
 
-            EllipticCurvePoint(const Element& x, Element&& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(const Element& x, Element&& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_X {x},
                 m_Y {std::move(y)},
                 m_Z {m_field->element(1)},
@@ -1066,10 +1102,9 @@ namespace elliptic_curve_guide {
                     && "EllipticCurvePoint<CoordinatesType::ModifiedJacobi>::EllipticCurvePoint : invalid coordinates");
             }
 
-            EllipticCurvePoint(Element&& x, Element&& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(Element&& x, Element&& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_X {std::move(x)},
                 m_Y {std::move(y)},
                 m_Z {m_field->element(1)},
@@ -1097,11 +1132,11 @@ namespace elliptic_curve_guide {
                     return;
                 }
 
-                const Element Y2 = Element::pow(m_Y, 2);
+                const Element Y2 = Element::square(m_Y);
                 const Element V = (m_X * Y2) << 2;
-                const Element U = Element::pow(Y2, 2) << 3;
-                const Element W = m_field->element(3) * Element::pow(m_X, 2) + m_aZ4;
-                m_X = -(V << 1) + Element::pow(W, 2);
+                const Element U = Element::square(Y2) << 3;
+                const Element W = Accumulator(m_X, m_X + m_X + m_X).add(m_aZ4).reduce();
+                m_X = -(V << 1) + Element::square(W);
                 m_Z = (m_Y * m_Z) << 1;
                 m_Y = W * (V - m_X) - U;
                 m_aZ4 = (U * m_aZ4) << 1;
@@ -1114,11 +1149,11 @@ namespace elliptic_curve_guide {
                     return true;
                 }
 
-                const Element Z2 = Element::pow(m_Z, 2);
-                const Element Z4 = Element::pow(Z2, 2);
+                const Element Z2 = Element::square(m_Z);
+                const Element Z4 = Element::square(Z2);
                 const Element Z6 = Z4 * Z2;
-                const Element value = Element::pow(m_X, 3) + m_X * m_aZ4 + *m_b * Z6;
-                return m_aZ4 == (*m_a * Z4) && Element::pow(m_Y, 2) == value;
+                const Element value = Element::cube(m_X) + m_X * m_aZ4 + *m_b * Z6;
+                return m_aZ4 == (*m_a * Z4) && Element::square(m_Y) == value;
             }
 
             Element m_X;
@@ -1127,13 +1162,22 @@ namespace elliptic_curve_guide {
             Element m_aZ4;
         };
 
-        template<>
-        class EllipticCurvePoint<CoordinatesType::SimplifiedJacobiChudnovski>
-            : public EllipticCurvePointConcept {
+        template<typename Field>
+        class EllipticCurvePoint<CoordinatesType::SimplifiedJacobiChudnovski, Field>
+            : public EllipticCurvePointConcept<Field> {
         private:
-            friend class EllipticCurve;
+            using Base = EllipticCurvePointConcept<Field>;
+            using typename Base::Element;
+            using typename Base::uint_type;
+            using Accumulator = typename Element::Accumulator;
+            using Base::m_a;
+            using Base::m_b;
+            using Base::m_field;
+            using Base::m_is_null;
+
+            friend class BasicEllipticCurve<Field>;
             friend EllipticCurvePoint algorithm::wnaf_addition<EllipticCurvePoint>(EllipticCurvePoint value,
-                                                                                   const uint& n);
+                                                                                   const uint_type& n);
 
         public:
             friend bool operator==(const EllipticCurvePoint& lhs, const EllipticCurvePoint& rhs) {
@@ -1173,14 +1217,16 @@ namespace elliptic_curve_guide {
                 }
 
                 const Element H = X2Z1 - X1Z2;
-                const Element H2 = Element::pow(H, 2);
+                const Element H2 = Element::square(H);
                 const Element H3 = H2 * H;
                 const Element r = Y2Z1 - Y1Z2;
 
-                m_X = -H3 - ((X1Z2 * H2) << 1) + Element::pow(r, 2);
-                m_Y = -Y1Z2 * H3 + r * (X1Z2 * H2 - m_X);
+                const Element U = X1Z2 * H2;
+
+                m_X = -H3 - (U << 1) + Element::square(r);
+                m_Y = Accumulator(r, U - m_X).subtract_product(Y1Z2, H3).reduce();
                 m_Z = m_Z * other.m_Z * H;
-                m_Z2 = Element::pow(m_Z, 2);
+                m_Z2 = Element::square(m_Z);
 
                 assert(
                     is_valid()
@@ -1199,12 +1245,12 @@ namespace elliptic_curve_guide {
                 return *this += other;
             }
 
-            EllipticCurvePoint& operator*=(const uint& value) {
+            EllipticCurvePoint& operator*=(const uint_type& value) {
                 *this = algorithm::wnaf_addition<EllipticCurvePoint>(*this, value);
                 return *this;
             }
 
-            EllipticCurvePoint& operator*=(const field::FieldElement& element) {
+            EllipticCurvePoint& operator*=(const ScalarElement<Field>& element) {
                 *this = algorithm::wnaf_addition<EllipticCurvePoint>(*this, element.value());
                 return *this;
             }
@@ -1218,18 +1264,13 @@ namespace elliptic_curve_guide {
             }
 
         private:
-            static EllipticCurvePoint null_point(std::shared_ptr<const Element> a,
-                                                 std::shared_ptr<const Element>
-                                                     b,
-                                                 std::shared_ptr<const Field>
-                                                     F) {
+            static EllipticCurvePoint null_point(const Element* a, const Element* b, const Field* F) {
                 return EllipticCurvePoint(F->element(0), F->element(1), a, b, F, true);
             }
 
-            EllipticCurvePoint(const Element& x, const Element& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(const Element& x, const Element& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_X {x},
                 m_Y {y},
                 m_Z {m_field->element(1)},
@@ -1239,10 +1280,9 @@ namespace elliptic_curve_guide {
                     && "EllipticCurvePoint<CoordinatesType::SimplifiedJacobiChudnovski>::EllipticCurvePoint : invalid coordinates");
             }
 
-            EllipticCurvePoint(Element&& x, const Element& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(Element&& x, const Element& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_X {std::move(x)},
                 m_Y {y},
                 m_Z {m_field->element(1)},
@@ -1252,10 +1292,9 @@ namespace elliptic_curve_guide {
                     && "EllipticCurvePoint<CoordinatesType::SimplifiedJacobiChudnovski>::EllipticCurvePoint : invalid coordinates");
             }
 
-            EllipticCurvePoint(const Element& x, Element&& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(const Element& x, Element&& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_X {x},
                 m_Y {std::move(y)},
                 m_Z {m_field->element(1)},
@@ -1265,10 +1304,9 @@ namespace elliptic_curve_guide {
                     && "EllipticCurvePoint<CoordinatesType::SimplifiedJacobiChudnovski>::EllipticCurvePoint : invalid coordinates");
             }
 
-            EllipticCurvePoint(Element&& x, Element&& y, std::shared_ptr<const Element> a,
-                               std::shared_ptr<const Element> b, std::shared_ptr<const Field> F,
-                               bool is_null = false) :
-                EllipticCurvePointConcept(std::move(a), std::move(b), std::move(F), is_null),
+            EllipticCurvePoint(Element&& x, Element&& y, const Element* a, const Element* b,
+                               const Field* F, bool is_null = false) :
+                Base(a, b, F, is_null),
                 m_X {std::move(x)},
                 m_Y {std::move(y)},
                 m_Z {m_field->element(1)},
@@ -1296,14 +1334,15 @@ namespace elliptic_curve_guide {
                     return;
                 }
 
-                const Element Y2 = Element::pow(m_Y, 2);
-                const Element Y4 = Element::pow(Y2, 2);
+                const Element Y2 = Element::square(m_Y);
                 const Element V = (m_X * Y2) << 2;
-                const Element W = m_field->element(3) * Element::pow(m_X, 2) + *m_a * Element::pow(m_Z2, 2);
-                m_X = -(V << 1) + Element::pow(W, 2);
+                const Element W = Accumulator(m_X, m_X + m_X + m_X)
+                                      .add_product(*m_a, Element::square(m_Z2))
+                                      .reduce();
+                m_X = -(V << 1) + Element::square(W);
                 m_Z = (m_Y * m_Z) << 1;
-                m_Y = -(Y4 << 3) + W * (V - m_X);
-                m_Z2 = Element::pow(m_Z, 2);
+                m_Y = Accumulator(W, V - m_X).subtract_product(Y2, Y2 << 3).reduce();
+                m_Z2 = Element::square(m_Z);
                 assert(
                     is_valid()
                     && "EllipticCurvePoint<CoordinatesType::SimplifiedJacobiChudnovski>::twice : invalid coordinates");
@@ -1314,10 +1353,10 @@ namespace elliptic_curve_guide {
                     return true;
                 }
 
-                const Element Z4 = Element::pow(m_Z2, 2);
+                const Element Z4 = Element::square(m_Z2);
                 const Element Z6 = Z4 * m_Z2;
-                const Element value = Element::pow(m_X, 3) + *m_a * m_X * Z4 + *m_b * Z6;
-                return Element::pow(m_Y, 2) == value;
+                const Element value = Element::cube(m_X) + *m_a * m_X * Z4 + *m_b * Z6;
+                return Element::square(m_Y) == value;
             }
 
             Element m_X;
@@ -1326,22 +1365,23 @@ namespace elliptic_curve_guide {
             Element m_Z2;
         };
 
-        class EllipticCurve {
-            using Field = field::Field;
-            using Element = field::FieldElement;
+        // A curve y^2 = x^3 + ax + b over Field, which is a field::BasicField or a field::StaticField
+        template<typename Field>
+        class BasicEllipticCurve {
+            using Element = typename Field::Element;
 
         public:
-            EllipticCurve(const Element& a, const Element& b, Field F);
-            EllipticCurve(Element&& a, const Element& b, Field F);
-            EllipticCurve(const Element& a, Element&& b, Field F);
-            EllipticCurve(Element&& a, Element&& b, Field F);
+            BasicEllipticCurve(const Element& a, const Element& b, Field F);
+            BasicEllipticCurve(Element&& a, const Element& b, Field F);
+            BasicEllipticCurve(const Element& a, Element&& b, Field F);
+            BasicEllipticCurve(Element&& a, Element&& b, Field F);
 
             const Field& get_field() const;
             const Element& get_a() const;
             const Element& get_b() const;
 
             template<CoordinatesType type = CoordinatesType::Normal>
-            std::optional<EllipticCurvePoint<type>> point_with_x_equal_to(const Element& x) const {
+            std::optional<EllipticCurvePoint<type, Field>> point_with_x_equal_to(const Element& x) const {
                 if (!x.is_invertible()) {
                     return null_point<type>();
                 }
@@ -1352,11 +1392,11 @@ namespace elliptic_curve_guide {
                     return std::nullopt;
                 }
 
-                return EllipticCurvePoint<type>(x, std::move(y.value()), m_a, m_b, m_field);
+                return EllipticCurvePoint<type, Field>(x, std::move(y.value()), m_a, m_b, m_field);
             }
 
             template<CoordinatesType type = CoordinatesType::Normal>
-            std::optional<EllipticCurvePoint<type>> point_with_x_equal_to(Element&& x) const {
+            std::optional<EllipticCurvePoint<type, Field>> point_with_x_equal_to(Element&& x) const {
                 if (!x.is_invertible()) {
                     return null_point<type>();
                 }
@@ -1367,11 +1407,11 @@ namespace elliptic_curve_guide {
                     return std::nullopt;
                 }
 
-                return EllipticCurvePoint<type>(std::move(x), std::move(y.value()), m_a, m_b, m_field);
+                return EllipticCurvePoint<type, Field>(std::move(x), std::move(y.value()), m_a, m_b, m_field);
             }
 
             template<CoordinatesType type = CoordinatesType::Normal>
-            std::optional<EllipticCurvePoint<type>> point(const Element& x, const Element& y) const {
+            std::optional<EllipticCurvePoint<type, Field>> point(const Element& x, const Element& y) const {
                 if (is_null_coordinates(x, y)) {
                     return null_point<type>();
                 }
@@ -1380,11 +1420,11 @@ namespace elliptic_curve_guide {
                     return std::nullopt;
                 }
 
-                return EllipticCurvePoint<type>(x, y, m_a, m_b, m_field);
+                return EllipticCurvePoint<type, Field>(x, y, m_a, m_b, m_field);
             }
 
             template<CoordinatesType type = CoordinatesType::Normal>
-            std::optional<EllipticCurvePoint<type>> point(Element&& x, const Element& y) const {
+            std::optional<EllipticCurvePoint<type, Field>> point(Element&& x, const Element& y) const {
                 if (is_null_coordinates(x, y)) {
                     return null_point<type>();
                 }
@@ -1393,11 +1433,11 @@ namespace elliptic_curve_guide {
                     return std::nullopt;
                 }
 
-                return EllipticCurvePoint<type>(std::move(x), y, m_a, m_b, m_field);
+                return EllipticCurvePoint<type, Field>(std::move(x), y, m_a, m_b, m_field);
             }
 
             template<CoordinatesType type = CoordinatesType::Normal>
-            std::optional<EllipticCurvePoint<type>> point(const Element& x, Element&& y) const {
+            std::optional<EllipticCurvePoint<type, Field>> point(const Element& x, Element&& y) const {
                 if (is_null_coordinates(x, y)) {
                     return null_point<type>();
                 }
@@ -1406,11 +1446,11 @@ namespace elliptic_curve_guide {
                     return std::nullopt;
                 }
 
-                return EllipticCurvePoint<type>(x, std::move(y), m_a, m_b, m_field);
+                return EllipticCurvePoint<type, Field>(x, std::move(y), m_a, m_b, m_field);
             }
 
             template<CoordinatesType type = CoordinatesType::Normal>
-            std::optional<EllipticCurvePoint<type>> point(Element&& x, Element&& y) const {
+            std::optional<EllipticCurvePoint<type, Field>> point(Element&& x, Element&& y) const {
                 if (is_null_coordinates(x, y)) {
                     return null_point<type>();
                 }
@@ -1419,20 +1459,22 @@ namespace elliptic_curve_guide {
                     return std::nullopt;
                 }
 
-                return EllipticCurvePoint<type>(std::move(x), std::move(y), m_a, m_b, m_field);
+                return EllipticCurvePoint<type, Field>(std::move(x), std::move(y), m_a, m_b, m_field);
             }
 
             template<CoordinatesType type = CoordinatesType::Normal>
-            EllipticCurvePoint<type> null_point() const {
-                return EllipticCurvePoint<type>::null_point(m_a, m_b, m_field);
+            EllipticCurvePoint<type, Field> null_point() const {
+                return EllipticCurvePoint<type, Field>::null_point(m_a, m_b, m_field);
             }
 
             template<CoordinatesType type = CoordinatesType::Normal>
-            EllipticCurvePoint<type> random_point() const {
+            EllipticCurvePoint<type, Field> random_point() const {
                 static constexpr size_t c_repeat_number = 1000;
 
                 for (size_t i = 0; i < c_repeat_number; ++i) {
-                    Element x = algorithm::random::generate_random_field_element(*m_field);
+                    const ScalarUint<Field> value =
+                        algorithm::random::generate_random_uint_modulo(m_field->modulus());
+                    Element x = m_field->element(value);
                     auto opt = point_with_x_equal_to<type>(x);
 
                     if (opt.has_value()) {
@@ -1448,10 +1490,90 @@ namespace elliptic_curve_guide {
             bool is_valid_coordinates(const Element& x, const Element& y) const;
             std::optional<Element> find_y(const Element& x) const;
 
-            std::shared_ptr<const Element> m_a;
-            std::shared_ptr<const Element> m_b;
-            std::shared_ptr<const Field> m_field;
+            // Shared by all curves with equal parameters and freed with the last of them. Points refer to it
+            // as field elements refer to the modulus of their field
+            struct Parameters;
+
+            std::shared_ptr<const Parameters> m_parameters;
+            const Element* m_a;
+            const Element* m_b;
+            const Field* m_field;
         };
+
+        template<typename Field>
+        struct BasicEllipticCurve<Field>::Parameters {
+            Element a;
+            Element b;
+            Field field;
+        };
+
+        template<typename Field>
+        BasicEllipticCurve<Field>::BasicEllipticCurve(const Element& a, const Element& b, Field F) {
+            using Key = std::tuple<ScalarUint<Field>, ScalarUint<Field>, ScalarUint<Field>>;
+            const Key key = {F.modulus(), a.value(), b.value()};
+            m_parameters = algorithm::Registry<Key, const Parameters>::find_or_make(key, [&] {
+                return new const Parameters {.a = a, .b = b, .field = std::move(F)};
+            });
+
+            m_a = &m_parameters->a;
+            m_b = &m_parameters->b;
+            m_field = &m_parameters->field;
+        }
+
+        template<typename Field>
+        BasicEllipticCurve<Field>::BasicEllipticCurve(Element&& a, const Element& b, Field F) :
+            BasicEllipticCurve(static_cast<const Element&>(a), b, std::move(F)) {}
+
+        template<typename Field>
+        BasicEllipticCurve<Field>::BasicEllipticCurve(const Element& a, Element&& b, Field F) :
+            BasicEllipticCurve(a, static_cast<const Element&>(b), std::move(F)) {}
+
+        template<typename Field>
+        BasicEllipticCurve<Field>::BasicEllipticCurve(Element&& a, Element&& b, Field F) :
+            BasicEllipticCurve(static_cast<const Element&>(a), static_cast<const Element&>(b),
+                               std::move(F)) {}
+
+        template<typename Field>
+        const Field& BasicEllipticCurve<Field>::get_field() const {
+            return *m_field;
+        }
+
+        template<typename Field>
+        const typename Field::Element& BasicEllipticCurve<Field>::get_a() const {
+            return *m_a;
+        }
+
+        template<typename Field>
+        const typename Field::Element& BasicEllipticCurve<Field>::get_b() const {
+            return *m_b;
+        }
+
+        template<typename Field>
+        bool BasicEllipticCurve<Field>::is_valid_coordinates(const Element& x, const Element& y) const {
+            const Element lhs = Element::pow(y, 2);
+            const Element rhs = Element::pow(x, 3) + *m_a * x + *m_b;
+            return lhs == rhs;
+        }
+
+        template<typename Field>
+        bool BasicEllipticCurve<Field>::is_null_coordinates(const Element& x, const Element& y) const {
+            return x.value() == 0 && y.value() == 1;
+        }
+
+        template<typename Field>
+        std::optional<typename Field::Element> BasicEllipticCurve<Field>::find_y(const Element& x) const {
+            Element value = Element::pow(x, 3) + *m_a * x + *m_b;
+            return algorithm::find_root(value, *m_field);
+        }
+
+        using EllipticCurve = BasicEllipticCurve<>;
+
+        extern template class BasicEllipticCurve<field::Field>;
+#ifndef ECG_USE_BOOST
+        extern template class BasicEllipticCurve<field::BasicField<uint256>>;
+        extern template class BasicEllipticCurve<field::BasicField<uint384>>;
+        extern template class BasicEllipticCurve<field::BasicField<uint576>>;
+#endif
     }   // namespace elliptic_curve
 }   // namespace elliptic_curve_guide
 
@@ -0,0 +1,366 @@
+#ifndef ECG_FIELD_VECTOR_H
+#define ECG_FIELD_VECTOR_H
+
+#include "field.h"
+#include "utils/bitsize.h"
+#include "utils/lanes.h"
+#include "utils/montgomery.h"
+
+#include <cassert>
+#include <span>
+#include <vector>
+
+namespace elliptic_curve_guide {
+    namespace field {
+        // The modulus of an odd field in 32-bit limbs and the constant rows of the vector kernels, built by
+        // the first vector of the field and shared by all fields with the same modulus
+        template<typename T>
+        struct BasicFieldVectorContext {
+            using Element = BasicFieldElement<T>;
+            using Limbs = algorithm::lanes::AlignedLimbs;
+
+            explicit BasicFieldVectorContext(const BasicField<T>& field);
+            BasicFieldVectorContext(const BasicFieldVectorContext&) = delete;
+
+            // The limbs of an odd modulus without the leading zero ones
+            static std::vector<uint32_t> split(const T& p);
+
+            // value in c_max_lanes lanes, which serve a set of lanes of any policy
+            static Limbs broadcast(const T& value, size_t size);
+
+            static T read(const Limbs& limbs, size_t stride, size_t pos, size_t size);
+            static void write(Limbs& limbs, size_t stride, size_t pos, size_t size, const T& value);
+
+            std::vector<uint32_t> limbs;
+            algorithm::lanes::Modulus modulus;
+            Element to_montgomery;     // R mod p, by doublings that never leave the width of T
+            Element from_montgomery;   // R^-1
+            Limbs one;                 // R, one in Montgomery form
+            Limbs r_squared;           // R^2, multiplication by it converts into Montgomery form
+            Limbs unit;                // 1, multiplication by it converts out of Montgomery form
+        };
+
+        // Many elements of one field with an odd modulus, stored as a structure of arrays: limb j of every
+        // element lies in one contiguous row, so the element-wise kernels handle a set of lanes of elements
+        // at once. Elements are kept in Montgomery form with R = 2^(32 * limbs) and converted by the kernels
+        // on the way in and out of whole vectors, single elements go through the field. The lanes are those
+        // of the widest extension of the processor, or the policy Lanes
+        template<typename T, typename Lanes = algorithm::lanes::DispatchedLanes>
+        class BasicFieldVector {
+        public:
+            using Element = BasicFieldElement<T>;
+
+            BasicFieldVector(const BasicField<T>& field, size_t size);
+            BasicFieldVector(const BasicField<T>& field, std::span<const Element> elements);
+
+            static BasicFieldVector square(BasicFieldVector vector);
+
+            friend BasicFieldVector operator+(BasicFieldVector lhs, const BasicFieldVector& rhs) {
+                return lhs += rhs;
+            }
+
+            friend BasicFieldVector operator-(BasicFieldVector lhs, const BasicFieldVector& rhs) {
+                return lhs -= rhs;
+            }
+
+            friend BasicFieldVector operator*(BasicFieldVector lhs, const BasicFieldVector& rhs) {
+                return lhs *= rhs;
+            }
+
+            BasicFieldVector& operator+=(const BasicFieldVector& other);
+            BasicFieldVector& operator-=(const BasicFieldVector& other);
+            BasicFieldVector& operator*=(const BasicFieldVector& other);
+
+            // Montgomery's trick in every lane: the prefix products run down the lanes side by side, so n
+            // elements take a single inversion of a set of lanes and 3n multiplications of the kernel, zero
+            // elements are left as they are
+            void batch_inverse();
+
+            Element operator[](size_t pos) const;
+            void set(size_t pos, const Element& element);
+            std::vector<Element> elements() const;
+
+            size_t size() const;
+            const BasicField<T>& field() const;
+
+        private:
+            static constexpr size_t c_max_lanes = algorithm::lanes::c_max_lanes;
+            static constexpr size_t c_row_alignment =
+                algorithm::lanes::AlignedAllocator<uint32_t>::c_alignment / sizeof(uint32_t);
+
+            using Context = BasicFieldVectorContext<T>;
+            using Limbs = algorithm::lanes::AlignedLimbs;
+            using Row = algorithm::lanes::Row;
+            using ConstRow = algorithm::lanes::ConstRow;
+
+            Row row(size_t index);
+            ConstRow row(size_t index) const;
+            size_t lanes() const;
+            size_t rows() const;
+
+            BasicField<T> m_field;
+            const Context* m_context;
+            const algorithm::lanes::KernelTable* m_kernels;
+            size_t m_size;
+            size_t m_stride;
+            Limbs m_limbs;
+        };
+
+        using FieldVector = BasicFieldVector<uint>;
+
+        template<typename T>
+        BasicFieldVectorContext<T>::BasicFieldVectorContext(const BasicField<T>& field) :
+            limbs(split(field.modulus())),
+            modulus {.limbs = limbs.data(),
+                     .size = limbs.size(),
+                     .inverse = algorithm::montgomery::inverse<uint32_t>(limbs[0])},
+            to_montgomery(field.element(1) <<= T(32 * limbs.size())),
+            from_montgomery(Element::inverse(to_montgomery)),
+            one(broadcast(to_montgomery.value(), limbs.size())),
+            r_squared(broadcast(Element::square(to_montgomery).value(), limbs.size())),
+            unit(broadcast(1, limbs.size())) {}
+
+        template<typename T>
+        std::vector<uint32_t> BasicFieldVectorContext<T>::split(const T& p) {
+            assert(algorithm::test_bit(p, 0) && "FieldVector : modulus must be odd");
+            std::vector<uint32_t> result((algorithm::actual_bit_size(p) + 31) / 32);
+
+            for (size_t j = 0; j < result.size(); ++j) {
+                result[j] = algorithm::extract_bits(p, 32 * j, 32);
+            }
+
+            return result;
+        }
+
+        template<typename T>
+        algorithm::lanes::AlignedLimbs BasicFieldVectorContext<T>::broadcast(const T& value, size_t size) {
+            Limbs result(size * algorithm::lanes::c_max_lanes);
+
+            for (size_t k = 0; k < algorithm::lanes::c_max_lanes; ++k) {
+                write(result, algorithm::lanes::c_max_lanes, k, size, value);
+            }
+
+            return result;
+        }
+
+        template<typename T>
+        T BasicFieldVectorContext<T>::read(const Limbs& limbs, size_t stride, size_t pos, size_t size) {
+            T result = 0;
+
+            for (size_t j = size; j > 0; --j) {
+                result <<= 32;
+                result |= T(limbs[(j - 1) * stride + pos]);
+            }
+
+            return result;
+        }
+
+        template<typename T>
+        void BasicFieldVectorContext<T>::write(Limbs& limbs, size_t stride, size_t pos, size_t size,
+                                               const T& value) {
+            for (size_t j = 0; j < size; ++j) {
+                limbs[j * stride + pos] = algorithm::extract_bits(value, 32 * j, 32);
+            }
+        }
+
+        template<typename T, typename Lanes>
+        BasicFieldVector<T, Lanes>::BasicFieldVector(const BasicField<T>& field, size_t size) :
+            m_field(field), m_context(&field.vector_context()),
+            m_kernels(&algorithm::lanes::kernel_table<Lanes, uint_traits<T>::bits / 32>()), m_size(size),
+            m_stride((size + c_row_alignment - 1) / c_row_alignment * c_row_alignment),
+            m_limbs(m_stride * m_context->modulus.size) {}
+
+        template<typename T, typename Lanes>
+        BasicFieldVector<T, Lanes>::BasicFieldVector(const BasicField<T>& field,
+                                                     std::span<const Element> elements) :
+            BasicFieldVector(field, elements.size()) {
+            const size_t size = m_context->modulus.size;
+
+            for (size_t i = 0; i < m_size; ++i) {
+                assert(elements[i].modulus() == field.modulus()
+                       && "FieldVector::FieldVector : elements must belong to the field");
+                Context::write(m_limbs, m_stride, i, size, elements[i].value());
+            }
+
+            const ConstRow r_squared = {m_context->r_squared.data(), c_max_lanes};
+
+            for (size_t index = 0; index < rows(); ++index) {
+                m_kernels->multiply(row(index), r_squared, row(index), m_context->modulus);
+            }
+        }
+
+        template<typename T, typename Lanes>
+        BasicFieldVector<T, Lanes> BasicFieldVector<T, Lanes>::square(BasicFieldVector vector) {
+            for (size_t index = 0; index < vector.rows(); ++index) {
+                vector.m_kernels->multiply(vector.row(index), vector.row(index), vector.row(index),
+                                           vector.m_context->modulus);
+            }
+
+            return vector;
+        }
+
+        template<typename T, typename Lanes>
+        BasicFieldVector<T, Lanes>& BasicFieldVector<T, Lanes>::operator+=(const BasicFieldVector& other) {
+            assert(m_field == other.m_field && m_size == other.m_size
+                   && "FieldVector::operator+= : vectors must be of the same field and size");
+
+            for (size_t index = 0; index < rows(); ++index) {
+                m_kernels->add(row(index), other.row(index), row(index), m_context->modulus);
+            }
+
+            return *this;
+        }
+
+        template<typename T, typename Lanes>
+        BasicFieldVector<T, Lanes>& BasicFieldVector<T, Lanes>::operator-=(const BasicFieldVector& other) {
+            assert(m_field == other.m_field && m_size == other.m_size
+                   && "FieldVector::operator-= : vectors must be of the same field and size");
+
+            for (size_t index = 0; index < rows(); ++index) {
+                m_kernels->subtract(row(index), other.row(index), row(index), m_context->modulus);
+            }
+
+            return *this;
+        }
+
+        template<typename T, typename Lanes>
+        BasicFieldVector<T, Lanes>& BasicFieldVector<T, Lanes>::operator*=(const BasicFieldVector& other) {
+            assert(m_field == other.m_field && m_size == other.m_size
+                   && "FieldVector::operator*= : vectors must be of the same field and size");
+
+            for (size_t index = 0; index < rows(); ++index) {
+                m_kernels->multiply(row(index), other.row(index), row(index), m_context->modulus);
+            }
+
+            return *this;
+        }
+
+        template<typename T, typename Lanes>
+        void BasicFieldVector<T, Lanes>::batch_inverse() {
+            if (m_size == 0) {
+                return;
+            }
+
+            const algorithm::lanes::Modulus& modulus = m_context->modulus;
+            const size_t size = modulus.size;
+            const size_t width = lanes();
+            const ConstRow one = {m_context->one.data(), c_max_lanes};
+
+            // Zero elements take no part in the products
+            Limbs values = m_limbs;
+            Limbs prefixes(m_limbs.size());
+            const auto values_row = [&](size_t index) {
+                return Row {values.data() + index * width, m_stride};
+            };
+            const auto prefix_row = [&](size_t index) {
+                return Row {prefixes.data() + index * width, m_stride};
+            };
+
+            for (size_t index = 0; index < rows(); ++index) {
+                m_kernels->replace_zero(one, values_row(index), size);
+            }
+
+            m_kernels->multiply(values_row(0), one, prefix_row(0), modulus);
+
+            for (size_t index = 1; index < rows(); ++index) {
+                m_kernels->multiply(prefix_row(index - 1), values_row(index), prefix_row(index), modulus);
+            }
+
+            // The products of the lanes are inverted by the field
+            std::vector<Element> totals;
+            const size_t last = (rows() - 1) * width;
+
+            for (size_t k = 0; k < width; ++k) {
+                totals.push_back(m_field.element(Context::read(prefixes, m_stride, last + k, size))
+                                 * m_context->from_montgomery);
+            }
+
+            Element::batch_inverse(totals);
+            Limbs inverse(size * width);
+            Limbs result(size * width);
+
+            for (size_t k = 0; k < width; ++k) {
+                Context::write(inverse, width, k, size, (totals[k] * m_context->to_montgomery).value());
+            }
+
+            const Row inverse_row = {inverse.data(), width};
+            const Row result_row = {result.data(), width};
+
+            for (size_t index = rows() - 1; index > 0; --index) {
+                m_kernels->multiply(inverse_row, prefix_row(index - 1), result_row, modulus);
+                m_kernels->multiply(inverse_row, values_row(index), inverse_row, modulus);
+                m_kernels->replace_non_zero(result_row, row(index), size);
+            }
+
+            m_kernels->replace_non_zero(inverse_row, row(0), size);
+        }
+
+        template<typename T, typename Lanes>
+        BasicFieldElement<T> BasicFieldVector<T, Lanes>::operator[](size_t pos) const {
+            assert(pos < m_size && "FieldVector::operator[] : position must be less than size");
+            const T value = Context::read(m_limbs, m_stride, pos, m_context->modulus.size);
+            return m_field.element(value) * m_context->from_montgomery;
+        }
+
+        template<typename T, typename Lanes>
+        void BasicFieldVector<T, Lanes>::set(size_t pos, const Element& element) {
+            assert(pos < m_size && "FieldVector::set : position must be less than size");
+            assert(element.modulus() == m_field.modulus()
+                   && "FieldVector::set : element must belong to the field");
+            const T value = (element * m_context->to_montgomery).value();
+            Context::write(m_limbs, m_stride, pos, m_context->modulus.size, value);
+        }
+
+        template<typename T, typename Lanes>
+        std::vector<BasicFieldElement<T>> BasicFieldVector<T, Lanes>::elements() const {
+            BasicFieldVector plain = *this;
+            const ConstRow unit = {m_context->unit.data(), c_max_lanes};
+
+            for (size_t index = 0; index < rows(); ++index) {
+                m_kernels->multiply(plain.row(index), unit, plain.row(index), m_context->modulus);
+            }
+
+            std::vector<Element> result;
+            result.reserve(m_size);
+
+            for (size_t i = 0; i < m_size; ++i) {
+                const T value = Context::read(plain.m_limbs, m_stride, i, m_context->modulus.size);
+                result.push_back(m_field.element(value));
+            }
+
+            return result;
+        }
+
+        template<typename T, typename Lanes>
+        size_t BasicFieldVector<T, Lanes>::size() const {
+            return m_size;
+        }
+
+        template<typename T, typename Lanes>
+        const BasicField<T>& BasicFieldVector<T, Lanes>::field() const {
+            return m_field;
+        }
+
+        template<typename T, typename Lanes>
+        algorithm::lanes::Row BasicFieldVector<T, Lanes>::row(size_t index) {
+            return {m_limbs.data() + index * lanes(), m_stride};
+        }
+
+        template<typename T, typename Lanes>
+        algorithm::lanes::ConstRow BasicFieldVector<T, Lanes>::row(size_t index) const {
+            return {m_limbs.data() + index * lanes(), m_stride};
+        }
+
+        template<typename T, typename Lanes>
+        size_t BasicFieldVector<T, Lanes>::lanes() const {
+            return m_kernels->lanes;
+        }
+
+        // The sets of lanes that hold the elements, the rest of a row is padding of zeros
+        template<typename T, typename Lanes>
+        size_t BasicFieldVector<T, Lanes>::rows() const {
+            return (m_size + lanes() - 1) / lanes();
+        }
+    }   // namespace field
+}   // namespace elliptic_curve_guide
+#endif
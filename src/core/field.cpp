@@ -1,240 +1,467 @@
 #include "field.h"
 
-#include "utils/fast-pow.h"
+#include "field-vector.h"
+#include "utils/bitsize.h"
+#include "utils/field_root.h"
+#include "utils/jacobi-symbol.h"
 #include "utils/modulo_inversion.h"
+#include "utils/registry.h"
+
+#include <memory>
+#include <mutex>
 
 namespace elliptic_curve_guide::field {
-    FieldElement::FieldElement(const uint& value, std::shared_ptr<const uint> modulus) :
-        m_value(normalize(value, modulus)), m_modulus(std::move(modulus)) {
+    template<typename T>
+    BasicFieldElement<T>::BasicFieldElement(const T& value, const Modulus* modulus) :
+        m_value(modulus->encode(value)), m_modulus(modulus) {
         assert(is_valid() && "FieldElement::FieldElement() : Field element value must be less than modulus");
     }
 
-    FieldElement FieldElement::operator-() const {
+    template<typename T>
+    BasicFieldElement<T> BasicFieldElement<T>::operator-() const {
         if (!is_invertible()) {
             return *this;
         }
 
-        return FieldElement(*m_modulus - m_value, m_modulus);
-    }
-
-    // operator+
-    FieldElement operator+(const FieldElement& lhs, const FieldElement& rhs) {
-        FieldElement result = lhs;
-        result += rhs;
+        BasicFieldElement result = *this;
+        result.m_value = m_modulus->value - m_value;
         return result;
     }
 
-    FieldElement operator+(FieldElement&& lhs, const FieldElement& rhs) {
-        lhs += rhs;
-        return lhs;
-    }
+    // x + y >= m exactly when x >= m - y, which also holds when x + y does not fit into T
+    template<typename T>
+    BasicFieldElement<T>& BasicFieldElement<T>::operator+=(const BasicFieldElement& other) {
+        const T gap = m_modulus->value - other.m_value;
 
-    FieldElement operator+(const FieldElement& lhs, FieldElement&& rhs) {
-        rhs += lhs;
-        return rhs;
-    }
+        if (m_value >= gap) {
+            m_value -= gap;
+        } else {
+            m_value += other.m_value;
+        }
 
-    FieldElement operator+(FieldElement&& lhs, FieldElement&& rhs) {
-        lhs += rhs;
-        return lhs;
+        assert(is_valid() && "FieldElement::operator+= : Field element value must be less than modulus");
+        return *this;
     }
 
-    // operator-
-    FieldElement operator-(const FieldElement& lhs, const FieldElement& rhs) {
-        FieldElement result = lhs;
-        result -= rhs;
-        return result;
+    // x + m may wrap around, then subtracting y wraps it back
+    template<typename T>
+    BasicFieldElement<T>& BasicFieldElement<T>::operator-=(const BasicFieldElement& other) {
+        if (m_value < other.m_value) {
+            m_value += m_modulus->value;
+        }
+
+        m_value -= other.m_value;
+
+        assert(is_valid() && "FieldElement::operator-= : Field element value must be less than modulus");
+        return *this;
     }
 
-    FieldElement operator-(FieldElement&& lhs, const FieldElement& rhs) {
-        lhs -= rhs;
-        return lhs;
+    template<typename T>
+    BasicFieldElement<T>& BasicFieldElement<T>::operator*=(const BasicFieldElement& other) {
+        m_value = m_modulus->multiply(m_value, other.m_value);
+
+        assert(is_valid() && "FieldElement::operator*= : Field element value must be less than modulus");
+        return *this;
     }
 
-    FieldElement operator-(const FieldElement& lhs, FieldElement&& rhs) {
-        return -(rhs -= lhs);
+    template<typename T>
+    BasicFieldElement<T>& BasicFieldElement<T>::operator/=(const BasicFieldElement& other) {
+        return (*this *= inverse(other));
     }
 
-    FieldElement operator-(FieldElement&& lhs, FieldElement&& rhs) {
-        lhs -= rhs;
-        return lhs;
+    // Doubling commutes with the Montgomery form, so the shift needs no conversion
+    template<typename T>
+    BasicFieldElement<T>& BasicFieldElement<T>::operator<<=(const T& shift) {
+        for (size_t i = 0; i < shift; ++i) {
+            *this += *this;
+        }
+
+        assert(is_valid() && "FieldElement::operator<<= : Field element value must be less than modulus");
+        return *this;
     }
 
-    // operator*
-    FieldElement operator*(const FieldElement& lhs, const FieldElement& rhs) {
-        FieldElement result = lhs;
-        result *= rhs;
-        return result;
+    template<typename T>
+    void BasicFieldElement<T>::inverse() {
+        m_value = m_modulus->inverse(m_value);
+        assert(is_valid() && "FieldElement::inverse : Field element value must be less than modulus");
     }
 
-    FieldElement operator*(FieldElement&& lhs, const FieldElement& rhs) {
-        lhs *= rhs;
-        return lhs;
+    template<typename T>
+    bool BasicFieldElement<T>::is_invertible() const {
+        return m_value != 0;
     }
 
-    FieldElement operator*(const FieldElement& lhs, FieldElement&& rhs) {
-        rhs *= lhs;
-        return rhs;
+    template<typename T>
+    int BasicFieldElement<T>::jacobi_symbol() const {
+        if (!is_invertible()) {
+            return 0;
+        }
+
+        // Every element of F_2 is a square
+        if ((m_modulus->value & 1) == 0) {
+            return 1;
+        }
+
+        return algorithm::jacobi_symbol(value(), m_modulus->value);
     }
 
-    FieldElement operator*(FieldElement&& lhs, FieldElement&& rhs) {
-        lhs *= rhs;
-        return lhs;
+    template<typename T>
+    void BasicFieldElement<T>::pow(const T& power) {
+        *this = pow(*this, power);
     }
 
-    // operator/
-    FieldElement operator/(const FieldElement& lhs, const FieldElement& rhs) {
-        FieldElement result = lhs;
-        result /= rhs;
+    template<typename T>
+    BasicFieldElement<T> BasicFieldElement<T>::inverse(const BasicFieldElement& element) {
+        BasicFieldElement result = element;
+        result.inverse();
         return result;
     }
 
-    FieldElement operator/(FieldElement&& lhs, const FieldElement& rhs) {
-        lhs /= rhs;
-        return lhs;
+    template<typename T>
+    BasicFieldElement<T> BasicFieldElement<T>::inverse(BasicFieldElement&& element) {
+        element.inverse();
+        return element;
     }
 
-    FieldElement operator/(const FieldElement& lhs, FieldElement&& rhs) {
-        rhs.inverse();
-        return lhs * rhs;
-    }
+    template<typename T>
+    void BasicFieldElement<T>::batch_inverse(std::span<BasicFieldElement> elements) {
+        if (elements.empty()) {
+            return;
+        }
 
-    FieldElement operator/(FieldElement&& lhs, FieldElement&& rhs) {
-        lhs /= rhs;
-        return lhs;
-    }
+        // prefixes[k] is the product of the first k + 1 invertible elements
+        const Modulus& modulus = *elements.front().m_modulus;
+        std::vector<T> prefixes;
+        prefixes.reserve(elements.size());
 
-    FieldElement operator<<(const FieldElement& value, const uint& shift) {
-        FieldElement result = value;
-        result <<= shift;
-        return result;
+        for (const BasicFieldElement& element : elements) {
+            assert(element.modulus() == modulus.value
+                   && "FieldElement::batch_inverse : elements must belong to the same field");
+
+            if (element.is_invertible()) {
+                prefixes.push_back(prefixes.empty() ? element.m_value
+                                                    : modulus.multiply(prefixes.back(), element.m_value));
+            }
+        }
+
+        if (prefixes.empty()) {
+            return;
+        }
+
+        // inverse is the inverse of the product of all invertible elements up to the current one
+        T inverse = modulus.inverse(prefixes.back());
+        prefixes.pop_back();
+
+        for (auto it = elements.rbegin(); it != elements.rend(); ++it) {
+            if (!it->is_invertible()) {
+                continue;
+            }
+
+            if (prefixes.empty()) {
+                it->m_value = inverse;
+                break;
+            }
+
+            const T value = it->m_value;
+            it->m_value = modulus.multiply(inverse, prefixes.back());
+            inverse = modulus.multiply(inverse, value);
+            prefixes.pop_back();
+        }
     }
 
-    FieldElement operator<<(FieldElement&& value, const uint& shift) {
-        value <<= shift;
-        return value;
+    template<typename T>
+    BasicFieldElement<T>::Accumulator::Accumulator(const BasicFieldElement& lhs,
+                                                   const BasicFieldElement& rhs) :
+        m_value(mul_wide(lhs.m_value, rhs.m_value)), m_element(lhs) {
+        assert(lhs.modulus() == rhs.modulus()
+               && "FieldElement::Accumulator::Accumulator : elements must belong to the same field");
     }
 
-    FieldElement& FieldElement::operator+=(const FieldElement& other) {
-        m_value += other.m_value;
+    template<typename T>
+    typename BasicFieldElement<T>::Accumulator&
+        BasicFieldElement<T>::Accumulator::add(const BasicFieldElement& element) {
+        assert(element.modulus() == m_element.modulus()
+               && "FieldElement::Accumulator::add : elements must belong to the same field");
+        const wide_type sum = m_value + m_element.m_modulus->widen(element.m_value);
 
-        if (m_value >= *m_modulus) {
-            m_value -= *m_modulus;
+        if (sum < m_value) {
+            assert(m_element.m_modulus->is_full_width && "FieldElement::Accumulator::add : too many terms");
+            ++m_wrap_arounds;
         }
 
-        assert(is_valid() && "FieldElement::operator+= : Field element value must be less than modulus");
+        m_value = sum;
         return *this;
     }
 
-    FieldElement& FieldElement::operator-=(const FieldElement& other) {
-        if (m_value < other.m_value) {
-            m_value += *m_modulus;
+    template<typename T>
+    typename BasicFieldElement<T>::Accumulator&
+        BasicFieldElement<T>::Accumulator::subtract(const BasicFieldElement& element) {
+        return add(-element);
+    }
+
+    template<typename T>
+    typename BasicFieldElement<T>::Accumulator&
+        BasicFieldElement<T>::Accumulator::add_product(const BasicFieldElement& lhs,
+                                                       const BasicFieldElement& rhs) {
+        assert(lhs.modulus() == m_element.modulus() && rhs.modulus() == m_element.modulus()
+               && "FieldElement::Accumulator::add_product : elements must belong to the same field");
+
+        if (!m_element.m_modulus->is_full_width) {
+            add_mul_wide(m_value, lhs.m_value, rhs.m_value);
+            return *this;
         }
 
-        m_value -= other.m_value;
+        const wide_type sum = m_value + mul_wide(lhs.m_value, rhs.m_value);
 
-        assert(is_valid() && "FieldElement::operator-= : Field element value must be less than modulus");
+        if (sum < m_value) {
+            ++m_wrap_arounds;
+        }
+
+        m_value = sum;
         return *this;
     }
 
-    FieldElement& FieldElement::operator*=(const FieldElement& other) {
-        m_value *= other.m_value;
+    // x * y is subtracted as x * (m - y), every term stays non-negative
+    template<typename T>
+    typename BasicFieldElement<T>::Accumulator&
+        BasicFieldElement<T>::Accumulator::subtract_product(const BasicFieldElement& lhs,
+                                                            const BasicFieldElement& rhs) {
+        return add_product(lhs, -rhs);
+    }
+
+    template<typename T>
+    BasicFieldElement<T> BasicFieldElement<T>::Accumulator::reduce() const {
+        const Modulus& modulus = *m_element.m_modulus;
+        BasicFieldElement result = m_element;
+        result.m_value = modulus.reduce(m_value);
+        BasicFieldElement wrap_around = m_element;
+        wrap_around.m_value = modulus.wrap_around;
 
-        if (m_value >= *m_modulus) {
-            m_value %= *m_modulus;
+        for (size_t i = 0; i < m_wrap_arounds; ++i) {
+            result += wrap_around;
         }
 
-        assert(is_valid() && "FieldElement::operator*= : Field element value must be less than modulus");
-        return *this;
+        assert(result.is_valid()
+               && "FieldElement::Accumulator::reduce : Field element value must be less than modulus");
+        return result;
     }
 
-    FieldElement& FieldElement::operator/=(const FieldElement& other) {
-        return (*this *= inverse(other));
-    }
+    template<typename T>
+    BasicFieldElement<T> BasicFieldElement<T>::pow(const BasicFieldElement& element, const T& power) {
+        if (power == 0) {
+            return BasicFieldElement(1, element.m_modulus);
+        }
 
-    FieldElement& FieldElement::operator<<=(const uint& shift) {
-        for (size_t i = 0; i < shift; ++i) {
-            m_value <<= 1;
+        return algorithm::fast_pow<BasicFieldElement>(element, power);
+    }
 
-            if (m_value >= *m_modulus) {
-                m_value %= *m_modulus;
-            }
+    template<typename T>
+    BasicFieldElement<T> BasicFieldElement<T>::pow(const BasicFieldElement& element,
+                                                   const algorithm::PowerPlan& plan) {
+        if (plan.power() == 0) {
+            return BasicFieldElement(1, element.m_modulus);
         }
 
-        assert(is_valid() && "FieldElement::operator<<= : Field element value must be less than modulus");
-        return *this;
+        const Modulus& modulus = *element.m_modulus;
+        const auto multiply = [&modulus](const T& x, const T& y) { return modulus.multiply(x, y); };
+        const auto square = [&modulus](const T& value) { return modulus.square(value); };
+        BasicFieldElement result = element;
+        result.m_value = plan.run(element.m_value, multiply, square);
+        assert(result.is_valid() && "FieldElement::pow : Field element value must be less than modulus");
+        return result;
     }
 
-    bool operator==(const FieldElement& lhs, const FieldElement& rhs) {
-        return lhs.m_value == rhs.m_value;
+    template<typename T>
+    BasicFieldElement<T> BasicFieldElement<T>::square(const BasicFieldElement& element) {
+        BasicFieldElement result = element;
+        result.m_value = element.m_modulus->square(element.m_value);
+        assert(result.is_valid() && "FieldElement::square : Field element value must be less than modulus");
+        return result;
     }
 
-    void FieldElement::inverse() {
-        m_value = algorithm::inverse_modulo(m_value, *m_modulus);
-        assert(is_valid() && "FieldElement::inverse : Field element value must be less than modulus");
+    template<typename T>
+    BasicFieldElement<T> BasicFieldElement<T>::cube(const BasicFieldElement& element) {
+        return square(element) * element;
     }
 
-    bool FieldElement::is_invertible() const {
-        return m_value != 0;
+    template<typename T>
+    const T& BasicFieldElement<T>::modulus() const {
+        return m_modulus->value;
     }
 
-    void FieldElement::pow(const uint& power) {
-        *this = pow(*this, power);
+    template<typename T>
+    T BasicFieldElement<T>::value() const {
+        return m_modulus->decode(m_value);
     }
 
-    FieldElement FieldElement::inverse(const FieldElement& element) {
-        FieldElement result = element;
-        result.inverse();
-        return result;
+    template<typename T>
+    bool BasicFieldElement<T>::is_valid() const {
+        return m_value < m_modulus->value;
     }
+#ifdef ECG_USE_BOOST
+    template<typename T>
+    BasicField<T>::BasicField(const char* str) : BasicField(T(str)) {}
 
-    FieldElement FieldElement::inverse(FieldElement&& element) {
-        element.inverse();
-        return element;
+    template<typename T>
+    BasicFieldElement<T> BasicField<T>::element(const char* str) const {
+        return Element(T(str), m_modulus);
     }
+#endif
 
-    FieldElement FieldElement::pow(const FieldElement& element, const uint& power) {
-        if (power == 0) {
-            return FieldElement(1, element.m_modulus);
+    // r = 2^bits mod m, then multiply(r, r) = reduce(r^2) = reduce(2^(2 * bits)) for every kind of reduction
+    template<typename T>
+    BasicFieldElement<T>::Modulus::Modulus(const T& value) :
+        value(value), barrett(wide_type(value)),
+        is_full_width(algorithm::actual_bit_size(value) + 4 > uint_traits<T>::bits) {
+#ifndef ECG_USE_BOOST
+        special = T::SpecialModulus::find(value);
+
+        if (!special && value.test_bit(0)) {
+            montgomery.emplace(value);
         }
+#endif
+        const T r = (T(0) - value) % value;
+        wrap_around = multiply(r, r);
+    }
 
-        return algorithm::fast_pow<FieldElement>(element, power);
+    template<typename T>
+    T BasicFieldElement<T>::Modulus::encode(const T& value) const {
+        const T result = value < this->value ? value : T(wide_type(value) % barrett);
+#ifndef ECG_USE_BOOST
+        if (montgomery) {
+            return montgomery->to_montgomery(result);
+        }
+#endif
+        return result;
     }
 
-    const uint& FieldElement::modulus() const {
-        return *m_modulus;
+    template<typename T>
+    T BasicFieldElement<T>::Modulus::decode(const T& value) const {
+#ifndef ECG_USE_BOOST
+        if (montgomery) {
+            return montgomery->from_montgomery(value);
+        }
+#endif
+        return value;
     }
 
-    const uint& FieldElement::value() const {
-        return m_value;
+    template<typename T>
+    T BasicFieldElement<T>::Modulus::multiply(const T& lhs, const T& rhs) const {
+#ifndef ECG_USE_BOOST
+        if (special) {
+            return special->multiply(lhs, rhs);
+        }
+
+        if (montgomery) {
+            return montgomery->multiply(lhs, rhs);
+        }
+#endif
+        return T(mul_wide(lhs, rhs) % barrett);
     }
 
-    uint FieldElement::normalize(const uint& value, std::shared_ptr<const uint> modulus) {
-        return value % *modulus;
+    template<typename T>
+    T BasicFieldElement<T>::Modulus::square(const T& value) const {
+#ifndef ECG_USE_BOOST
+        if (special) {
+            return special->square(value);
+        }
+
+        if (montgomery) {
+            return montgomery->multiply(value, value);
+        }
+#endif
+        return T(square_wide(value) % barrett);
     }
 
-    bool FieldElement::is_valid() const {
-        return m_value < *m_modulus;
+    template<typename T>
+    T BasicFieldElement<T>::Modulus::inverse(const T& value) const {
+        return encode(algorithm::inverse_modulo(decode(value), this->value));
     }
-#ifdef ECG_USE_BOOST
-    Field::Field(const char* str) : Field(uint(str)) {}
 
-    FieldElement Field::element(const char* str) const {
-        return FieldElement(uint(str), m_modulus);
+    template<typename T>
+    T BasicFieldElement<T>::Modulus::reduce(const wide_type& value) const {
+#ifndef ECG_USE_BOOST
+        if (special) {
+            return special->reduce(value);
+        }
+
+        if (montgomery) {
+            return montgomery->reduce(value);
+        }
+#endif
+        return T(value % barrett);
     }
+
+    template<typename T>
+    typename BasicFieldElement<T>::wide_type BasicFieldElement<T>::Modulus::widen(const T& value) const {
+#ifndef ECG_USE_BOOST
+        if (montgomery) {
+            return montgomery->widen(value);
+        }
 #endif
+        return wide_type(value);
+    }
 
-    Field::Field(const uint& modulus) : m_modulus(std::make_shared<const uint>(modulus)) {};
+    template<typename T>
+    struct BasicField<T>::Context {
+        explicit Context(const T& value) : modulus(value) {}
 
-    FieldElement Field::element(const uint& value) const {
-        return FieldElement(value, m_modulus);
+        const typename Element::Modulus modulus;
+        std::once_flag sqrt_flag;
+        std::unique_ptr<const algorithm::BasicSqrtContext<BasicField>> sqrt_context;
+        std::once_flag vector_flag;
+        std::unique_ptr<const BasicFieldVectorContext<T>> vector_context;
+    };
+
+    template<typename T>
+    BasicField<T>::BasicField(const T& modulus) :
+        m_context(algorithm::Registry<T, Context>::find_or_make(modulus, [&modulus] {
+            return new Context(modulus);
+        })) {
+        m_modulus = &m_context->modulus;
+    }
+
+    template<typename T>
+    BasicFieldElement<T> BasicField<T>::element(const T& value) const {
+        return Element(value, m_modulus);
     }
 
-    const uint& Field::modulus() const {
-        return *m_modulus;
+    template<typename T>
+    const T& BasicField<T>::modulus() const {
+        return m_modulus->value;
     }
 
-    bool Field::operator==(const Field& other) const {
-        return *m_modulus == *other.m_modulus;
+    template<typename T>
+    bool BasicField<T>::operator==(const BasicField& other) const {
+        return m_modulus == other.m_modulus;
     }
+
+    template<typename T>
+    const algorithm::BasicSqrtContext<BasicField<T>>& BasicField<T>::sqrt_context() const {
+        std::call_once(m_context->sqrt_flag, [this] {
+            m_context->sqrt_context = std::make_unique<const algorithm::BasicSqrtContext<BasicField>>(*this);
+        });
+
+        return *m_context->sqrt_context;
+    }
+
+    template<typename T>
+    const BasicFieldVectorContext<T>& BasicField<T>::vector_context() const {
+        std::call_once(m_context->vector_flag, [this] {
+            m_context->vector_context = std::make_unique<const BasicFieldVectorContext<T>>(*this);
+        });
+
+        return *m_context->vector_context;
+    }
+
+    template class BasicFieldElement<uint>;
+    template class BasicField<uint>;
+#ifndef ECG_USE_BOOST
+    template class BasicFieldElement<uint256>;
+    template class BasicField<uint256>;
+    template class BasicFieldElement<uint384>;
+    template class BasicField<uint384>;
+    template class BasicFieldElement<uint576>;
+    template class BasicField<uint576>;
+#endif
 }   // namespace elliptic_curve_guide::field
@@ -2,106 +2,306 @@
 #define ECG_FIELD_H
 
 #include "uint.h"
+#include "utils/fast-pow.h"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
 
 namespace elliptic_curve_guide {
+    namespace algorithm {
+        template<typename Field>
+        class BasicSqrtContext;
+    }   // namespace algorithm
+
     namespace field {
-        class FieldElement {
-            friend class Field;
+        template<typename T>
+        class BasicField;
+
+        template<typename T>
+        struct BasicFieldVectorContext;
+
+        // An element of a prime field whose values fit into T: uint, or uint256, uint384 and uint576 for the
+        // fields that need fewer or more digits
+        template<typename T>
+        class BasicFieldElement {
+            friend class BasicField<T>;
+
+            using wide_type = typename uint_traits<T>::wide;
+
+            // Shared by all fields with one modulus and owned by them. Elements refer to it by a plain
+            // pointer, so copying them costs no atomic reference counting, and an element must not outlive
+            // every field of its modulus. Special primes reduce by their own kernels, elements of other
+            // fields with an odd modulus are stored in Montgomery form and converted only on the way in and
+            // out, the rest reduce by Barrett
+            struct Modulus {
+                explicit Modulus(const T& value);
+
+                T encode(const T& value) const;
+                T decode(const T& value) const;
+                T multiply(const T& lhs, const T& rhs) const;
+                T square(const T& value) const;
+                T inverse(const T& value) const;
+
+                // Sums of products are kept in the domain of wide products: reduce(mul_wide(x, y)) is the
+                // same as multiply(x, y), and reduce(widen(x)) = x
+                T reduce(const wide_type& value) const;
+                wide_type widen(const T& value) const;
 
-            FieldElement(const uint& value, std::shared_ptr<const uint> modulus);
+                T value;
+                typename uint_traits<T>::barrett barrett;
+#ifndef ECG_USE_BOOST
+                std::optional<typename T::SpecialModulus> special;
+                std::optional<typename T::Montgomery> montgomery;
+#endif
+                // A modulus of nearly the full width of T leaves no room for sums of several products, so
+                // the Accumulator counts the times its sum wraps around and adds reduce(2^(2 * bits)) for
+                // each of them
+                bool is_full_width;
+                T wrap_around;
+            };
+
+            BasicFieldElement(const T& value, const Modulus* modulus);
 
         public:
-            static FieldElement inverse(const FieldElement& element);
-            static FieldElement inverse(FieldElement&& element);
-            static FieldElement pow(const FieldElement& element, const uint& power);
+            // A sum of products of elements of one field that is reduced once, when it is read
+            class Accumulator;
+
+            static BasicFieldElement inverse(const BasicFieldElement& element);
+            static BasicFieldElement inverse(BasicFieldElement&& element);
+
+            // Montgomery's trick: n elements of one field are inverted with a single inversion and 3(n - 1)
+            // multiplications, zero elements are left as they are
+            static void batch_inverse(std::span<BasicFieldElement> elements);
+
+            // Writes the inverses of [first, last) to result in the same way, returns the end of the output
+            template<typename InputIt, typename OutputIt>
+            static OutputIt batch_inverse(InputIt first, InputIt last, OutputIt result) {
+                std::vector<BasicFieldElement> elements(first, last);
+                batch_inverse(elements);
+                return std::move(elements.begin(), elements.end(), result);
+            }
+
+            static BasicFieldElement pow(const BasicFieldElement& element, const T& power);
+            static BasicFieldElement pow(const BasicFieldElement& element, const algorithm::PowerPlan& plan);
+            static BasicFieldElement square(const BasicFieldElement& element);
+            static BasicFieldElement cube(const BasicFieldElement& element);
+
+            friend BasicFieldElement operator+(const BasicFieldElement& lhs, const BasicFieldElement& rhs) {
+                BasicFieldElement result = lhs;
+                result += rhs;
+                return result;
+            }
+
+            friend BasicFieldElement operator+(BasicFieldElement&& lhs, const BasicFieldElement& rhs) {
+                lhs += rhs;
+                return lhs;
+            }
+
+            friend BasicFieldElement operator+(const BasicFieldElement& lhs, BasicFieldElement&& rhs) {
+                rhs += lhs;
+                return rhs;
+            }
+
+            friend BasicFieldElement operator+(BasicFieldElement&& lhs, BasicFieldElement&& rhs) {
+                lhs += rhs;
+                return lhs;
+            }
+
+            friend BasicFieldElement operator-(const BasicFieldElement& lhs, const BasicFieldElement& rhs) {
+                BasicFieldElement result = lhs;
+                result -= rhs;
+                return result;
+            }
+
+            friend BasicFieldElement operator-(BasicFieldElement&& lhs, const BasicFieldElement& rhs) {
+                lhs -= rhs;
+                return lhs;
+            }
+
+            friend BasicFieldElement operator-(const BasicFieldElement& lhs, BasicFieldElement&& rhs) {
+                return -(rhs -= lhs);
+            }
+
+            friend BasicFieldElement operator-(BasicFieldElement&& lhs, BasicFieldElement&& rhs) {
+                lhs -= rhs;
+                return lhs;
+            }
 
-            friend FieldElement operator+(const FieldElement& lhs, const FieldElement& rhs);
-            friend FieldElement operator+(FieldElement&& lhs, const FieldElement& rhs);
-            friend FieldElement operator+(const FieldElement& lhs, FieldElement&& rhs);
-            friend FieldElement operator+(FieldElement&& lhs, FieldElement&& rhs);
+            friend BasicFieldElement operator*(const BasicFieldElement& lhs, const BasicFieldElement& rhs) {
+                BasicFieldElement result = lhs;
+                result *= rhs;
+                return result;
+            }
+
+            friend BasicFieldElement operator*(BasicFieldElement&& lhs, const BasicFieldElement& rhs) {
+                lhs *= rhs;
+                return lhs;
+            }
+
+            friend BasicFieldElement operator*(const BasicFieldElement& lhs, BasicFieldElement&& rhs) {
+                rhs *= lhs;
+                return rhs;
+            }
+
+            friend BasicFieldElement operator*(BasicFieldElement&& lhs, BasicFieldElement&& rhs) {
+                lhs *= rhs;
+                return lhs;
+            }
+
+            friend BasicFieldElement operator/(const BasicFieldElement& lhs, const BasicFieldElement& rhs) {
+                BasicFieldElement result = lhs;
+                result /= rhs;
+                return result;
+            }
+
+            friend BasicFieldElement operator/(BasicFieldElement&& lhs, const BasicFieldElement& rhs) {
+                lhs /= rhs;
+                return lhs;
+            }
 
-            friend FieldElement operator-(const FieldElement& lhs, const FieldElement& rhs);
-            friend FieldElement operator-(FieldElement&& lhs, const FieldElement& rhs);
-            friend FieldElement operator-(const FieldElement& lhs, FieldElement&& rhs);
-            friend FieldElement operator-(FieldElement&& lhs, FieldElement&& rhs);
+            friend BasicFieldElement operator/(const BasicFieldElement& lhs, BasicFieldElement&& rhs) {
+                rhs.inverse();
+                return lhs * rhs;
+            }
 
-            friend FieldElement operator*(const FieldElement& lhs, const FieldElement& rhs);
-            friend FieldElement operator*(FieldElement&& lhs, const FieldElement& rhs);
-            friend FieldElement operator*(const FieldElement& lhs, FieldElement&& rhs);
-            friend FieldElement operator*(FieldElement&& lhs, FieldElement&& rhs);
+            friend BasicFieldElement operator/(BasicFieldElement&& lhs, BasicFieldElement&& rhs) {
+                lhs /= rhs;
+                return lhs;
+            }
 
-            friend FieldElement operator/(const FieldElement& lhs, const FieldElement& rhs);
-            friend FieldElement operator/(FieldElement&& lhs, const FieldElement& rhs);
-            friend FieldElement operator/(const FieldElement& lhs, FieldElement&& rhs);
-            friend FieldElement operator/(FieldElement&& lhs, FieldElement&& rhs);
+            friend BasicFieldElement operator<<(const BasicFieldElement& value, const T& shift) {
+                BasicFieldElement result = value;
+                result <<= shift;
+                return result;
+            }
 
-            friend FieldElement operator<<(const FieldElement& value, const uint& shift);
-            friend FieldElement operator<<(FieldElement&& value, const uint& shift);
+            friend BasicFieldElement operator<<(BasicFieldElement&& value, const T& shift) {
+                value <<= shift;
+                return value;
+            }
 
-            FieldElement operator-() const;
+            BasicFieldElement operator-() const;
 
-            FieldElement& operator+=(const FieldElement& other);
-            FieldElement& operator-=(const FieldElement& other);
-            FieldElement& operator*=(const FieldElement& other);
-            FieldElement& operator/=(const FieldElement& other);
-            FieldElement& operator<<=(const uint& shift);
+            BasicFieldElement& operator+=(const BasicFieldElement& other);
+            BasicFieldElement& operator-=(const BasicFieldElement& other);
+            BasicFieldElement& operator*=(const BasicFieldElement& other);
+            BasicFieldElement& operator/=(const BasicFieldElement& other);
+            BasicFieldElement& operator<<=(const T& shift);
 
-            friend bool operator==(const FieldElement& lhs, const FieldElement& rhs);
+            friend bool operator==(const BasicFieldElement& lhs, const BasicFieldElement& rhs) {
+                return lhs.m_value == rhs.m_value;
+            }
 
 #ifdef ECG_USE_BOOST
-            friend bool operator<(const FieldElement& lhs, const FieldElement& rhs) {
+            friend bool operator<(const BasicFieldElement& lhs, const BasicFieldElement& rhs) {
                 return lhs.m_value < rhs.m_value;
             }
 
-            friend bool operator>(const FieldElement& lhs, const FieldElement& rhs) {
+            friend bool operator>(const BasicFieldElement& lhs, const BasicFieldElement& rhs) {
                 return lhs.m_value > rhs.m_value;
             }
 
-            friend bool operator<=(const FieldElement& lhs, const FieldElement& rhs) {
+            friend bool operator<=(const BasicFieldElement& lhs, const BasicFieldElement& rhs) {
                 return lhs.m_value <= rhs.m_value;
             }
 
-            friend bool operator>=(const FieldElement& lhs, const FieldElement& rhs) {
+            friend bool operator>=(const BasicFieldElement& lhs, const BasicFieldElement& rhs) {
                 return lhs.m_value >= rhs.m_value;
             }
 
-            friend bool operator!=(const FieldElement& lhs, const FieldElement& rhs) {
+            friend bool operator!=(const BasicFieldElement& lhs, const BasicFieldElement& rhs) {
                 return lhs.m_value != rhs.m_value;
             }
 #else
-            friend std::strong_ordering operator<=>(const FieldElement& lhs, const FieldElement& rhs) {
-                return lhs.m_value <=> rhs.m_value;
+            friend std::strong_ordering operator<=>(const BasicFieldElement& lhs,
+                                                    const BasicFieldElement& rhs) {
+                return lhs.value() <=> rhs.value();
             }
 #endif
 
             bool is_invertible() const;
-            void pow(const uint& power);
+
+            // Legendre symbol by the binary Jacobi algorithm: 1 for non-zero squares, -1 for non-squares, 0
+            // for zero. Costs about as much as an inversion, much less than the Euler criterion
+            int jacobi_symbol() const;
+            void pow(const T& power);
             void inverse();
-            const uint& modulus() const;
-            const uint& value() const;
+            const T& modulus() const;
+            T value() const;
 
         private:
-            static uint normalize(const uint& value, std::shared_ptr<const uint> modulus);
             bool is_valid() const;
 
-            uint m_value;
-            std::shared_ptr<const uint> m_modulus;
+            T m_value;
+            const Modulus* m_modulus;
+        };
+
+        template<typename T>
+        class BasicFieldElement<T>::Accumulator {
+        public:
+            Accumulator(const BasicFieldElement& lhs, const BasicFieldElement& rhs);
+
+            Accumulator& add(const BasicFieldElement& element);
+            Accumulator& subtract(const BasicFieldElement& element);
+            Accumulator& add_product(const BasicFieldElement& lhs, const BasicFieldElement& rhs);
+            Accumulator& subtract_product(const BasicFieldElement& lhs, const BasicFieldElement& rhs);
+
+            BasicFieldElement reduce() const;
+
+        private:
+            // Every term is less than m^2 or m * R and costs the reduction up to one more subtraction
+            wide_type m_value;
+            size_t m_wrap_arounds = 0;
+            BasicFieldElement m_element;
         };
 
-        class Field {
+        template<typename T>
+        class BasicField {
         public:
+            using uint_type = T;
+            using Element = BasicFieldElement<T>;
+
 #ifdef ECG_USE_BOOST
-            Field(const char* str);
-            FieldElement element(const char* str) const;
+            BasicField(const char* str);
+            Element element(const char* str) const;
 #endif
-            Field(const uint& modulus);
-            FieldElement element(const uint& value) const;
-            const uint& modulus() const;
-            bool operator==(const Field& other) const;
+            BasicField(const T& modulus);
+            Element element(const T& value) const;
+            const T& modulus() const;
+            bool operator==(const BasicField& other) const;
+
+            // Built by the first call and shared by all fields with the same modulus
+            const algorithm::BasicSqrtContext<BasicField>& sqrt_context() const;
+
+            // Built by the first vector of the field and shared in the same way, the modulus must be odd
+            const BasicFieldVectorContext<T>& vector_context() const;
 
         private:
-            std::shared_ptr<const uint> m_modulus;
+            // The modulus, the square-root context and the vector context, freed with the last field of the
+            // modulus
+            struct Context;
+
+            const typename Element::Modulus* m_modulus;
+            std::shared_ptr<Context> m_context;
         };
+
+        using FieldElement = BasicFieldElement<uint>;
+        using Field = BasicField<uint>;
+
+        extern template class BasicFieldElement<uint>;
+        extern template class BasicField<uint>;
+#ifndef ECG_USE_BOOST
+        extern template class BasicFieldElement<uint256>;
+        extern template class BasicField<uint256>;
+        extern template class BasicFieldElement<uint384>;
+        extern template class BasicField<uint384>;
+        extern template class BasicFieldElement<uint576>;
+        extern template class BasicField<uint576>;
+#endif
     }   // namespace field
 }   // namespace elliptic_curve_guide
 
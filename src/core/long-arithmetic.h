@@ -1,49 +1,87 @@
 #ifndef ECG_LONG_ARITHMETIC_H
 #define ECG_LONG_ARITHMETIC_H
 
+#include "utils/binary-gcd.h"
 #include "utils/concepts.h"
-#include "utils/fft.h"
+#include "utils/digit-arithmetic.h"
+#include "utils/montgomery.h"
+#include "utils/multiplication.h"
+#include "utils/ntt.h"
+#include "utils/radix-conversion.h"
+#include "utils/special-reduction.h"
 #include "utils/string-parser.h"
 
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <cassert>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 namespace elliptic_curve_guide {
-    template<size_t c_bits>
+    // digit_t is the limb type: uint32_t or uint64_t (the latter is fast only with a native 128-bit type)
+    template<size_t c_bits, typename digit_t = uint32_t>
+    requires concepts::is_digit<digit_t>
     class uint_t {
-        using digit_t = uint32_t;
-        using double_digit_t = uint64_t;
-
         static constexpr size_t c_bits_in_byte = 8;
         static constexpr size_t c_digit_size = sizeof(digit_t) * c_bits_in_byte;
         static constexpr size_t c_digit_number = c_bits / c_digit_size;
-        static constexpr size_t c_double_digit_size = sizeof(double_digit_t) * c_bits_in_byte;
-        static constexpr size_t c_double_digit_number = c_bits / c_double_digit_size;
+        static constexpr size_t c_word_size = 32;
+        static constexpr size_t c_words_in_digit = c_digit_size / c_word_size;
 
-        template<size_t V>
+        template<size_t V, typename D>
+        requires concepts::is_digit<D>
         friend class uint_t;
 
         using digits = std::array<digit_t, c_digit_number>;
         digits m_digits = {};
 
     public:
+        // A divisor prepared for repeated division: its digits are normalized once and the reciprocal of the
+        // two top digits replaces the hardware division in every quotient digit
+        class Divisor;
+
+        // A modulus prepared for Barrett reduction: floor(b^2n / m) is computed once, after that the
+        // remainder of a value of up to 2n digits costs two multiplications and at most two subtractions
+        class Barrett;
+
+        // An odd modulus m of n digits prepared for Montgomery multiplication with R = b^n: values are kept
+        // as x * R mod m and multiplied without any division
+        class Montgomery;
+
+        // A modulus of a special form reduced by additions of parts of the value: NIST P-256 and P-384 by
+        // their Solinas decompositions, 2^k - c with c of at most 64 bits (secp256k1, Mersenne primes) by
+        // folding
+        class SpecialModulus;
+
         constexpr uint_t() = default;
 
+        // Only integers convert implicitly, so classes templated on uint_t do not pick its operators by ADL
         template<typename T>
+        requires std::numeric_limits<T>::is_integer
         constexpr uint_t(const T& value) : m_digits(split_into_digits<T>(value)) {}
 
-        constexpr uint_t(const char* str) : m_digits(algorithm::parse_into_uint<uint_t>(str).m_digits) {};
+        template<size_t V, typename D>
+        constexpr uint_t(const uint_t<V, D>& value) : m_digits(convert_digits<V, D>(value)) {}
+
+        constexpr uint_t(const char* str) : m_digits(parse(str)) {};
 
         constexpr uint_t& operator=(const uint_t& value) = default;
 
         template<typename T>
+        requires std::numeric_limits<T>::is_integer
         constexpr uint_t& operator=(const T& value) {
             m_digits = split_into_digits<T>(value);
             return *this;
         }
 
         constexpr uint_t& operator=(const char* str) {
-            return *this = parse_into_uint<uint_t>(str);
+            m_digits = parse(str);
+            return *this;
         }
 
         friend constexpr std::strong_ordering operator<=>(const uint_t& lhs, const uint_t& rhs) {
@@ -108,19 +146,55 @@ namespace elliptic_curve_guide {
         // operator*
         friend constexpr uint_t operator*(const uint_t& lhs, const uint_t& rhs) {
             uint_t result;
+            multiply(lhs, rhs, result.m_digits);
+            return result;
+        }
 
-            for (size_t i = 0; i < c_digit_number; ++i) {
-                uint64_t u = 0;
+        // Full product without truncation
+        friend constexpr uint_t<2 * c_bits, digit_t> mul_wide(const uint_t& lhs, const uint_t& rhs) {
+            uint_t<2 * c_bits, digit_t> result;
+            multiply(lhs, rhs, result.m_digits);
+            return result;
+        }
+
+        // result += lhs * rhs, the product is added row by row without a temporary, so sums of products stay
+        // as cheap as the products themselves
+        friend constexpr void add_mul_wide(uint_t<2 * c_bits, digit_t>& result, const uint_t& lhs,
+                                           const uint_t& rhs) {
+            const size_t lhs_size = lhs.actual_size();
+            const size_t rhs_size = rhs.actual_size();
+            digit_t top_carry = 0;
+
+            for (size_t i = 0; i < lhs_size; ++i) {
+                digit_t carry = 0;
 
-                for (size_t j = 0; i + j < c_digit_number; ++j) {
-                    u = static_cast<uint64_t>(result[i + j])
-                      + static_cast<uint64_t>(lhs[i]) * static_cast<uint64_t>(rhs[j]) + (u >> c_digit_size);
-                    result[i + j] = static_cast<uint32_t>(u);
+                for (size_t j = 0; j < rhs_size; ++j) {
+                    digit_t& digit = result.m_digits[i + j];
+                    digit = algorithm::digit::mul_add(lhs.m_digits[i], rhs.m_digits[j], digit, carry);
                 }
+
+                for (size_t j = i + rhs_size; carry != 0 && j < 2 * c_digit_number; ++j) {
+                    digit_t add_carry = 0;
+                    result.m_digits[j] = algorithm::digit::add(result.m_digits[j], carry, add_carry);
+                    carry = add_carry;
+                }
+
+                top_carry |= carry;
             }
 
+            assert(top_carry == 0 && "add_mul_wide : overflow");
+        }
+
+        static constexpr uint_t square(const uint_t& value) {
+            uint_t result;
+            square(value, result.m_digits);
+            return result;
+        }
+
+        friend constexpr uint_t<2 * c_bits, digit_t> square_wide(const uint_t& value) {
+            uint_t<2 * c_bits, digit_t> result;
+            square(value, result.m_digits);
             return result;
-            //return algorithm::fast_fourier_transform::multiply<c_digit_number>(lhs.m_digits, rhs.m_digits);
         }
 
         // operator/
@@ -129,6 +203,11 @@ namespace elliptic_curve_guide {
             return result;
         }
 
+        friend constexpr uint_t operator/(const uint_t& lhs, const Divisor& rhs) {
+            uint_t result = divide(lhs, rhs);
+            return result;
+        }
+
         // operator%
         friend constexpr uint_t operator%(const uint_t& lhs, const uint_t& rhs) {
             uint_t remainder;
@@ -136,6 +215,16 @@ namespace elliptic_curve_guide {
             return remainder;
         }
 
+        friend constexpr uint_t operator%(const uint_t& lhs, const Divisor& rhs) {
+            uint_t remainder;
+            divide(lhs, rhs, &remainder);
+            return remainder;
+        }
+
+        friend constexpr uint_t operator%(const uint_t& lhs, const Barrett& rhs) {
+            return reduce(lhs, rhs);
+        }
+
         // operator>>
         friend constexpr uint_t operator>>(const uint_t& lhs, const size_t& rhs) {
             uint_t result = lhs;
@@ -225,25 +314,32 @@ namespace elliptic_curve_guide {
         }
 
         constexpr uint_t& operator+=(const uint_t& other) {
+            const size_t other_size = other.actual_size();
             digit_t carry = 0;
+            size_t i = 0;
 
-            for (size_t i = 0; i < c_digit_number; ++i) {
-                digit_t sum = carry + other[i];
-                m_digits[i] += sum;
-                carry = (m_digits[i] < sum) || (sum < carry);
+            for (; i < other_size; ++i) {
+                m_digits[i] = algorithm::digit::add(m_digits[i], other[i], carry);
+            }
+
+            for (; carry != 0 && i < c_digit_number; ++i) {
+                m_digits[i] = algorithm::digit::add(m_digits[i], digit_t(0), carry);
             }
 
             return *this;
         }
 
         constexpr uint_t& operator-=(const uint_t& other) {
-            digit_t remainder = 0;
+            const size_t other_size = other.actual_size();
+            digit_t borrow = 0;
+            size_t i = 0;
 
-            for (size_t i = 0; i < c_digit_number; ++i) {
-                digit_t prev = m_digits[i];
-                digit_t sum = other[i] + remainder;
-                m_digits[i] -= sum;
-                remainder = (m_digits[i] > prev) || (sum < remainder);
+            for (; i < other_size; ++i) {
+                m_digits[i] = algorithm::digit::sub(m_digits[i], other[i], borrow);
+            }
+
+            for (; borrow != 0 && i < c_digit_number; ++i) {
+                m_digits[i] = algorithm::digit::sub(m_digits[i], digit_t(0), borrow);
             }
 
             return *this;
@@ -262,7 +358,7 @@ namespace elliptic_curve_guide {
         }
 
         constexpr uint_t& operator>>=(size_t shift_size) {
-            size_t digit_shift = shift_size >> 5;
+            size_t digit_shift = shift_size / c_digit_size;
 
             if (digit_shift > 0) {
                 for (size_t i = 0; i < c_digit_number; ++i) {
@@ -300,7 +396,7 @@ namespace elliptic_curve_guide {
         }
 
         constexpr uint_t& operator<<=(size_t shift_size) {
-            size_t digit_shift = shift_size >> 5;
+            size_t digit_shift = shift_size / c_digit_size;
 
             if (digit_shift > 0) {
                 for (size_t i = c_digit_number; i > 0; --i) {
@@ -388,6 +484,83 @@ namespace elliptic_curve_guide {
             return *this;
         }
 
+        // Number of significant bits, 0 for zero
+        constexpr size_t bit_length() const {
+            const size_t size = actual_size();
+
+            if (size == 0) {
+                return 0;
+            }
+
+            return (size - 1) * c_digit_size + static_cast<size_t>(std::bit_width(m_digits[size - 1]));
+        }
+
+        constexpr bool test_bit(size_t pos) const {
+            if (pos >= c_digit_number * c_digit_size) {
+                return false;
+            }
+
+            return ((m_digits[pos / c_digit_size] >> (pos % c_digit_size)) & 1) != 0;
+        }
+
+        // Number of trailing zero bits, c_digit_number * c_digit_size for zero as in std::countr_zero
+        constexpr size_t countr_zero() const {
+            for (size_t i = 0; i < c_digit_number; ++i) {
+                if (m_digits[i] != 0) {
+                    return i * c_digit_size + static_cast<size_t>(std::countr_zero(m_digits[i]));
+                }
+            }
+
+            return c_digit_number * c_digit_size;
+        }
+
+        // Bits [pos, pos + width) in the low bits of a digit, bits past the end are zeros. width is at most
+        // c_digit_size
+        constexpr digit_t extract_bits(size_t pos, size_t width) const {
+            assert(width <= c_digit_size && "uint_t::extract_bits : width must fit into a digit");
+            const size_t index = pos / c_digit_size;
+            const size_t offset = pos % c_digit_size;
+
+            if (width == 0 || index >= c_digit_number) {
+                return 0;
+            }
+
+            digit_t result = m_digits[index] >> offset;
+
+            if (offset + width > c_digit_size && index + 1 < c_digit_number) {
+                result |= m_digits[index + 1] << (c_digit_size - offset);
+            }
+
+            if (width < c_digit_size) {
+                result &= (static_cast<digit_t>(1) << width) - 1;
+            }
+
+            return result;
+        }
+
+        // Returns value^-1 mod modulus by the binary GCD, without any division. The modulus must be odd,
+        // value must be less than modulus and coprime to it
+        friend constexpr uint_t inverse_odd_modulo(const uint_t& value, const uint_t& modulus) {
+            assert(modulus.test_bit(0) && "uint_t::inverse_odd_modulo : modulus must be odd");
+            assert(value < modulus && "uint_t::inverse_odd_modulo : value must be less than modulus");
+            const size_t size = modulus.actual_size();
+            std::array<digit_t, algorithm::binary_gcd::buffer_size(c_digit_number)> buffer;
+            uint_t result;
+            algorithm::binary_gcd::inverse(value.m_digits.data(), modulus.m_digits.data(), size,
+                                           result.m_digits.data(), buffer.data());
+            return result;
+        }
+
+        // Returns the Jacobi symbol (value / modulus) by the binary algorithm. The modulus must be odd, value
+        // must be less than modulus
+        friend constexpr int binary_jacobi(const uint_t& value, const uint_t& modulus) {
+            assert(modulus.test_bit(0) && "uint_t::binary_jacobi : modulus must be odd");
+            assert(value < modulus && "uint_t::binary_jacobi : value must be less than modulus");
+            std::array<digit_t, 2 * c_digit_number> buffer;
+            return algorithm::binary_gcd::jacobi(value.m_digits.data(), modulus.m_digits.data(),
+                                                 modulus.actual_size(), buffer.data());
+        }
+
         template<typename T>
         constexpr T convert_to() const;
 
@@ -412,16 +585,49 @@ namespace elliptic_curve_guide {
 
         template<>
         constexpr std::string convert_to() const {
-            std::string result;
-            uint_t clone_of_this = *this;
+            std::string result(algorithm::radix::max_length(c_bits, 10), '0');
+            const std::to_chars_result status = to_chars(result.data(), result.data() + result.size(), *this);
+            result.resize(static_cast<size_t>(status.ptr - result.data()));
+            return result;
+        }
+
+        // Same contract as std::to_chars: symbols of value in base from 2 to 36 without a prefix,
+        // errc::value_too_large if [first, last) is too short
+        friend constexpr std::to_chars_result to_chars(char* first, char* last, const uint_t& value,
+                                                       int base = 10) {
+            assert(base >= algorithm::radix::c_min_base && base <= algorithm::radix::c_max_base
+                   && "uint_t::to_chars : base must be in [2, 36]");
+            digits scratch = value.m_digits;
+            return algorithm::radix::to_chars(scratch.data(), value.actual_size(), base, first, last);
+        }
+
+        // Same contract as std::from_chars: value is changed only on success, errc::invalid_argument if there
+        // is no symbol, errc::result_out_of_range if the number does not fit into c_bits
+        friend constexpr std::from_chars_result from_chars(const char* first, const char* last, uint_t& value,
+                                                           int base = 10) {
+            assert(base >= algorithm::radix::c_min_base && base <= algorithm::radix::c_max_base
+                   && "uint_t::from_chars : base must be in [2, 36]");
+            uint_t result;
+            const std::from_chars_result status =
+                algorithm::radix::from_chars(first, last, base, result.m_digits.data(), c_digit_number);
 
-            do {
-                uint_t remainder;
-                clone_of_this = divide(clone_of_this, 10, &remainder);
-                result.push_back(remainder.m_digits[0] + '0');
-            } while (clone_of_this > 0);
+            if (status.ec == std::errc()) {
+                value = result;
+            }
+
+            return status;
+        }
+
+        // The value of little-endian bytes: missing bytes are zeros, bytes past c_bits are ignored
+        static constexpr uint_t from_bytes(std::span<const uint8_t> bytes) {
+            uint_t result;
+            const size_t size = std::min(bytes.size(), c_digit_number * sizeof(digit_t));
+
+            for (size_t i = 0; i < size; ++i) {
+                const size_t shift = c_bits_in_byte * (i % sizeof(digit_t));
+                result.m_digits[i / sizeof(digit_t)] |= static_cast<digit_t>(bytes[i]) << shift;
+            }
 
-            std::reverse(result.begin(), result.end());
             return result;
         }
 
@@ -430,6 +636,22 @@ namespace elliptic_curve_guide {
             return c_digit_number;
         }
 
+        // Accepts 0x, 0b and 0 prefixes, an invalid string is UB
+        static constexpr digits parse(const char* str) {
+            assert(str != nullptr && "uint_t::parse : got nullptr");
+            const int base = algorithm::parse_radix_prefix(str);
+            const char* last = str + std::char_traits<char>::length(str);
+            uint_t result;
+
+            if (str != last) {
+                [[maybe_unused]] const std::from_chars_result status = from_chars(str, last, result, base);
+                assert(status.ec == std::errc() && status.ptr == last
+                       && "uint_t::parse : got incorrect string");
+            }
+
+            return result.m_digits;
+        }
+
         template<typename T>
         requires std::numeric_limits<T>::is_integer && concepts::is_upcastable_to<T, digit_t>
         static constexpr digits split_into_digits(T value) {
@@ -453,19 +675,73 @@ namespace elliptic_curve_guide {
             return result;
         }
 
-        template<typename T>
-        requires concepts::is_convertible_container<T, digit_t> || requires(T x) {
-            { elliptic_curve_guide::uint_t {x} } -> std::same_as<T>;
+        // Columns of the product past result.size() are dropped
+        template<size_t c_result_digit_number>
+        static constexpr void multiply(const uint_t& lhs,
+                                       const uint_t& rhs,
+                                       std::array<digit_t, c_result_digit_number>& result) {
+            const size_t lhs_size = lhs.actual_size();
+            const size_t rhs_size = rhs.actual_size();
+            constexpr size_t c_threshold = algorithm::multiplication::c_karatsuba_threshold;
+            constexpr size_t c_ntt_threshold =
+                algorithm::number_theoretic_transform::c_threshold * c_word_size;
+
+            if constexpr (c_bits >= c_ntt_threshold) {
+                if (!std::is_constant_evaluated()
+                    && std::min(lhs_size, rhs_size) * c_digit_size >= c_ntt_threshold) {
+                    const std::vector<uint32_t> product =
+                        algorithm::number_theoretic_transform::multiply(lhs.to_words(), rhs.to_words());
+                    result = {};
+
+                    const size_t words_number =
+                        std::min(product.size(), c_result_digit_number * c_words_in_digit);
+
+                    for (size_t i = 0; i < words_number; ++i) {
+                        result[i / c_words_in_digit] |= static_cast<digit_t>(product[i])
+                                                     << ((i % c_words_in_digit) * c_word_size);
+                    }
+
+                    return;
+                }
+            }
+
+            if constexpr (c_digit_number >= c_threshold) {
+                if (std::min(lhs_size, rhs_size) >= c_threshold) {
+                    const size_t size = std::max(lhs_size, rhs_size);
+                    std::array<digit_t, 2 * c_digit_number> product = {};
+                    constexpr size_t c_buffer_size =
+                        algorithm::multiplication::karatsuba_buffer_size(c_digit_number);
+                    std::array<digit_t, c_buffer_size> buffer = {};
+                    algorithm::multiplication::karatsuba(lhs.m_digits.data(), rhs.m_digits.data(), size,
+                                                         product.data(), buffer.data());
+
+                    for (size_t i = 0; i < c_result_digit_number && i < 2 * size; ++i) {
+                        result[i] = product[i];
+                    }
+
+                    return;
+                }
+            }
+
+            algorithm::multiplication::comba(lhs.m_digits.data(), lhs_size, rhs.m_digits.data(), rhs_size,
+                                             result.data(), c_result_digit_number);
         }
-        static constexpr digits split_into_digits(const T& other) {
-            const size_t min_size = std::min(size(), other.size());
-            digits result = {};
 
-            for (size_t i = 0; i < min_size; i++) {
-                result[i] = static_cast<digit_t>(other[i]);
+        template<size_t c_result_digit_number>
+        static constexpr void square(const uint_t& value,
+                                     std::array<digit_t, c_result_digit_number>& result) {
+            const size_t size = value.actual_size();
+            constexpr size_t c_threshold = algorithm::multiplication::c_karatsuba_threshold;
+
+            if constexpr (c_digit_number >= c_threshold) {
+                if (size >= c_threshold) {
+                    multiply(value, value, result);
+                    return;
+                }
             }
 
-            return result;
+            algorithm::multiplication::comba_square(value.m_digits.data(), size, result.data(),
+                                                    c_result_digit_number);
         }
 
         static constexpr uint_t divide(const uint_t& lhs, const uint_t& rhs, uint_t* remainder = nullptr) {
@@ -477,119 +753,200 @@ namespace elliptic_curve_guide {
                 return uint_t(0);
             }
 
-            if (rhs.actual_size() == 1) {
-                return divide(lhs, rhs[0], remainder);
+            return divide(lhs, Divisor(rhs), remainder);
+        }
+
+        // Knuth, TAOCP vol. 2, 4.3.1, algorithm D with the quotient digit estimated by div_3by2, the estimate
+        // is exact or one too big. Only the live digits of the dividend are normalized and processed, so a
+        // value much narrower than c_bits costs as little as its own width
+        static constexpr uint_t divide(const uint_t& lhs, const Divisor& rhs, uint_t* remainder = nullptr) {
+            const size_t dividend_size = lhs.actual_size();
+            const size_t divisor_size = rhs.m_size;
+
+            if (dividend_size < divisor_size || lhs < rhs.m_value) {
+                if (remainder != nullptr) {
+                    *remainder = lhs;
+                }
+
+                return uint_t(0);
             }
 
-            return d_divide(lhs, rhs, remainder);
-        }
+            std::array<digit_t, c_digit_number + 1> dividend = {};
+            const digit_t* divisor = rhs.m_normalized.data();
+            const size_t shift_size = rhs.m_shift;
+            uint_t quotient;
+            shift_left(lhs.m_digits.data(), dividend_size, shift_size, dividend.data());
 
-        static constexpr uint_t divide(const uint_t& lhs, const digit_t& rhs, uint_t* remainder = nullptr) {
-            uint_t result;
-            double_digit_t part = 0;
+            if (divisor_size == 1) {
+                digit_t part = dividend[dividend_size];
 
-            for (size_t i = c_digit_number; i > 0; --i) {
-                part = (part << (c_digit_size)) + static_cast<double_digit_t>(lhs[i - 1]);
+                for (size_t i = dividend_size; i > 0; --i) {
+                    quotient[i - 1] =
+                        algorithm::digit::div_2by1(part, dividend[i - 1], divisor[0], rhs.m_reciprocal, part);
+                }
 
-                if (part < rhs) {
-                    continue;
+                if (remainder != nullptr) {
+                    *remainder = uint_t(part >> shift_size);
                 }
 
-                result[i - 1] = static_cast<digit_t>(part / rhs);
-                part %= rhs;
+                return quotient;
+            }
+
+            const digit_t divisor_head = divisor[divisor_size - 1];
+            const digit_t divisor_next = divisor[divisor_size - 2];
+
+            for (size_t i = dividend_size - divisor_size + 1; i > 0; --i) {
+                const size_t pos = i - 1;
+                const digit_t dividend_head = dividend[pos + divisor_size];
+                const digit_t dividend_next = dividend[pos + divisor_size - 1];
+                digit_t quotient_temp = std::numeric_limits<digit_t>::max();
+
+                // Equal top digits make the quotient digit exactly b - 1
+                if (dividend_head != divisor_head || dividend_next != divisor_next) {
+                    digit_t remainder_high = 0;
+                    digit_t remainder_low = 0;
+                    quotient_temp = algorithm::digit::div_3by2(dividend_head, dividend_next,
+                                                               dividend[pos + divisor_size - 2], divisor_head,
+                                                               divisor_next, rhs.m_reciprocal, remainder_high,
+                                                               remainder_low);
+                }
+
+                digit_t carry = 0;
+                digit_t borrow = 0;
+
+                for (size_t j = 0; j < divisor_size; ++j) {
+                    digit_t product = algorithm::digit::mul_add(quotient_temp, divisor[j], digit_t(0), carry);
+                    dividend[pos + j] = algorithm::digit::sub(dividend[pos + j], product, borrow);
+                }
+
+                dividend[pos + divisor_size] =
+                    algorithm::digit::sub(dividend[pos + divisor_size], carry, borrow);
+
+                if (borrow != 0) {
+                    --quotient_temp;
+                    carry = 0;
+
+                    for (size_t j = 0; j < divisor_size; ++j) {
+                        dividend[pos + j] = algorithm::digit::add(dividend[pos + j], divisor[j], carry);
+                    }
+
+                    dividend[pos + divisor_size] += carry;
+                }
+
+                quotient[pos] = quotient_temp;
             }
 
             if (remainder != nullptr) {
-                *remainder = uint_t(static_cast<digit_t>(part));
+                *remainder = uint_t(0);
+
+                for (size_t i = 0; i < divisor_size; ++i) {
+                    (*remainder)[i] = dividend[i] >> shift_size;
+
+                    if (shift_size != 0) {
+                        (*remainder)[i] |= dividend[i + 1] << (c_digit_size - shift_size);
+                    }
+                }
             }
 
-            return result;
+            return quotient;
         }
 
-        static constexpr double_digit_t c_half_digit = static_cast<double_digit_t>(1) << (c_digit_size - 1);
-        static constexpr double_digit_t c_digit = static_cast<double_digit_t>(1) << c_digit_size;
+        // Menezes, van Oorschot, Vanstone, HAC 14.42. With n digits in the modulus m and the factor
+        // mu = floor(b^2n / m), q = floor(floor(x / b^(n - 1)) * mu / b^(n + 1)) is at most 2 below x / m,
+        // so only the low n + 1 digits of x - q * m are computed. Both shifts by whole digits are free
+        static constexpr uint_t reduce(const uint_t& lhs, const Barrett& rhs) {
+            const size_t size = rhs.m_size;
+            const size_t lhs_size = lhs.actual_size();
 
-        static constexpr uint_t d_divide(const uint_t& lhs, const uint_t& rhs, uint_t* remainder = nullptr) {
-            size_t dividend_size = lhs.actual_size();
-            size_t divisor_size = rhs.actual_size();
+            if (lhs_size < size || lhs < rhs.m_value) {
+                return lhs;
+            }
 
-            uint_t<c_bits + c_digit_size> dividend(lhs);
-            uint_t divisor(rhs);
-            uint_t quotient;
+            if (lhs_size > 2 * size || rhs.m_factor_size == 0) {
+                return lhs % rhs.m_value;
+            }
 
-            size_t shift_size = 0;
-            digit_t divisor_head = divisor[divisor_size - 1];
+            std::array<digit_t, c_digit_number + 2> quotient = {};
+            algorithm::multiplication::comba(lhs.m_digits.data() + size - 1, lhs_size - size + 1,
+                                             rhs.m_factor.m_digits.data(), rhs.m_factor_size, quotient.data(),
+                                             2 * size + 2);
 
-            while (divisor_head < c_half_digit) {
-                ++shift_size;
-                divisor_head <<= 1;
-            }
+            std::array<digit_t, c_digit_number + 1> product = {};
+            algorithm::multiplication::comba(quotient.data() + size + 1, size + 1,
+                                             rhs.m_value.m_digits.data(), size, product.data(), size + 1);
 
-            dividend <<= shift_size;
-            divisor <<= shift_size;
+            uint_t result;
+            digit_t borrow = 0;
 
-            double_digit_t divisor_ = divisor[divisor_size - 1];
+            for (size_t i = 0; i <= size; ++i) {
+                result[i] = algorithm::digit::sub(lhs[i], product[i], borrow);
+            }
 
-            for (size_t i = dividend_size - divisor_size + 1; i > 0; --i) {
-                double_digit_t part =
-                    (static_cast<double_digit_t>(dividend[i + divisor_size - 1]) << c_digit_size)
-                    + static_cast<double_digit_t>(dividend[i + divisor_size - 2]);
-                double_digit_t quotient_temp = part / divisor_;
-                part %= divisor_;
+            while (result >= rhs.m_value) {
+                result -= rhs.m_value;
+            }
 
-                if (quotient_temp == c_digit) {
-                    --quotient_temp;
-                    part += divisor_;
-                }
+            return result;
+        }
 
-                while (part < c_digit
-                       && (quotient_temp * divisor[divisor_size - 2]
-                           > (part << c_digit_size) + dividend[i + divisor_size - 3])) {
-                    --quotient_temp;
-                    part += divisor_;
-                }
+        // Writes size + 1 digits of value << shift_size into result, shift_size is less than c_digit_size
+        static constexpr void shift_left(const digit_t* value, size_t size, size_t shift_size,
+                                         digit_t* result) {
+            result[size] = shift_size == 0 ? 0 : value[size - 1] >> (c_digit_size - shift_size);
 
-                int64_t carry = 0;
-                int64_t widedigit = 0;
+            for (size_t i = size - 1; i > 0; --i) {
+                result[i] = value[i] << shift_size;
 
-                for (size_t j = 0; j < divisor_size; ++j) {
-                    double_digit_t product =
-                        static_cast<digit_t>(quotient_temp) * static_cast<double_digit_t>(divisor[j]);
-                    widedigit = (static_cast<int64_t>(dividend[i + j - 1]) + carry) - (product & UINT32_MAX);
-                    dividend[i + j - 1] = static_cast<digit_t>(widedigit);
-                    carry = (widedigit >> c_digit_size) - static_cast<int64_t>(product >> c_digit_size);
+                if (shift_size != 0) {
+                    result[i] |= value[i - 1] >> (c_digit_size - shift_size);
                 }
+            }
 
-                widedigit = static_cast<int64_t>(dividend[i + divisor_size - 1]) + carry;
-                dividend[i + divisor_size - 1] = static_cast<digit_t>(widedigit);
+            result[0] = value[0] << shift_size;
+        }
 
-                quotient[i - 1] = static_cast<digit_t>(quotient_temp);
+        template<size_t V, typename D>
+        static constexpr digits convert_digits(const uint_t<V, D>& other) {
+            digits result = {};
 
-                if (widedigit < 0) {
-                    --quotient[i - 1];
-                    widedigit = 0;
+            if constexpr (sizeof(D) == sizeof(digit_t)) {
+                for (size_t i = 0; i < c_digit_number && i < other.size(); ++i) {
+                    result[i] = static_cast<digit_t>(other[i]);
+                }
+            } else if constexpr (sizeof(D) < sizeof(digit_t)) {
+                constexpr size_t c_ratio = sizeof(digit_t) / sizeof(D);
 
-                    for (size_t j = 0; j < divisor_size; ++j) {
-                        widedigit += static_cast<double_digit_t>(dividend[i + j - 1]) + divisor[j];
-                        dividend[i + j - 1] = static_cast<digit_t>(widedigit);
-                        widedigit >>= 32;
-                    }
+                for (size_t i = 0; i < c_digit_number * c_ratio && i < other.size(); ++i) {
+                    result[i / c_ratio] |= static_cast<digit_t>(other[i])
+                                        << ((i % c_ratio) * other.c_digit_size);
+                }
+            } else {
+                constexpr size_t c_ratio = sizeof(D) / sizeof(digit_t);
+
+                for (size_t i = 0; i < c_digit_number && i / c_ratio < other.size(); ++i) {
+                    result[i] = static_cast<digit_t>(other[i / c_ratio] >> ((i % c_ratio) * c_digit_size));
                 }
             }
 
-            if (remainder != nullptr) {
-                *remainder = uint_t(0);
+            return result;
+        }
 
-                for (size_t i = 0; i < divisor_size - 1; ++i) {
-                    (*remainder)[i] =
-                        (dividend[i] >> shift_size)
-                        | (static_cast<double_digit_t>(dividend[i + 1]) << (c_digit_size - shift_size));
+        // Little-endian 32-bit words of the value without leading zero words
+        std::vector<uint32_t> to_words() const {
+            std::vector<uint32_t> result;
+            result.reserve(actual_size() * c_words_in_digit);
+
+            for (size_t i = 0; i < actual_size(); ++i) {
+                for (size_t j = 0; j < c_words_in_digit; ++j) {
+                    result.push_back(static_cast<uint32_t>(m_digits[i] >> (j * c_word_size)));
                 }
+            }
 
-                (*remainder)[divisor_size - 1] = dividend[divisor_size - 1] >> shift_size;
+            while (!result.empty() && result.back() == 0) {
+                result.pop_back();
             }
 
-            return quotient;
+            return result;
         }
 
         constexpr void negative() {
@@ -622,13 +979,11 @@ namespace elliptic_curve_guide {
         }
 
         constexpr uint_t operator*(digit_t other) const {
-            digit_t remainder = 0;
+            digit_t carry = 0;
             uint_t result;
 
             for (size_t i = 0; i < c_digit_number; ++i) {
-                double_digit_t prod = m_digits[i] * static_cast<double_digit_t>(other);
-                result[i] = static_cast<digit_t>(prod) + remainder;
-                remainder = static_cast<digit_t>(result[i] < remainder) + static_cast<digit_t>(prod >> 32);
+                result[i] = algorithm::digit::mul_add(m_digits[i], other, digit_t(0), carry);
             }
 
             return result;
@@ -652,6 +1007,276 @@ namespace elliptic_curve_guide {
             return result;
         }
     };
+
+    template<size_t c_bits, typename digit_t>
+    requires concepts::is_digit<digit_t>
+    class uint_t<c_bits, digit_t>::Divisor {
+    public:
+        constexpr explicit Divisor(const uint_t& value) : m_value(value), m_size(value.actual_size()) {
+            assert(m_size > 0 && "uint_t::Divisor::Divisor : division by zero");
+            std::array<digit_t, c_digit_number + 1> normalized = {};
+            m_shift = static_cast<size_t>(std::countl_zero(value[m_size - 1]));
+            shift_left(value.m_digits.data(), m_size, m_shift, normalized.data());
+            std::copy(normalized.begin(), normalized.begin() + m_size, m_normalized.begin());
+
+            if (m_size == 1) {
+                m_reciprocal = algorithm::digit::reciprocal_2by1(m_normalized[0]);
+            } else {
+                m_reciprocal =
+                    algorithm::digit::reciprocal_3by2(m_normalized[m_size - 1], m_normalized[m_size - 2]);
+            }
+        }
+
+        constexpr const uint_t& value() const {
+            return m_value;
+        }
+
+    private:
+        friend class uint_t;
+
+        uint_t m_value;
+        digits m_normalized = {};   // m_value << m_shift
+        size_t m_size = 0;
+        size_t m_shift = 0;
+        digit_t m_reciprocal = 0;   // reciprocal_3by2 of the two top digits, reciprocal_2by1 for one digit
+    };
+
+    template<size_t c_bits, typename digit_t>
+    requires concepts::is_digit<digit_t>
+    class uint_t<c_bits, digit_t>::Barrett {
+    public:
+        constexpr explicit Barrett(const uint_t& value) : m_value(value), m_size(value.actual_size()) {
+            assert(m_size > 0 && "uint_t::Barrett::Barrett : division by zero");
+
+            // b^2n - 1 stands in for b^2n, the factor is one less only when m is a power of two, and the
+            // reduction may then take one more subtraction. Moduli wider than half of uint_t use division
+            if (2 * m_size <= c_digit_number) {
+                uint_t numerator;
+
+                for (size_t i = 0; i < 2 * m_size; ++i) {
+                    numerator[i] = std::numeric_limits<digit_t>::max();
+                }
+
+                m_factor = numerator / m_value;
+                m_factor_size = m_factor.actual_size();
+            }
+        }
+
+        constexpr const uint_t& value() const {
+            return m_value;
+        }
+
+    private:
+        friend class uint_t;
+
+        uint_t m_value;
+        uint_t m_factor;   // floor((b^2n - 1) / m_value), has at most n + 1 digits
+        size_t m_size = 0;
+        size_t m_factor_size = 0;
+    };
+
+    template<size_t c_bits, typename digit_t>
+    requires concepts::is_digit<digit_t>
+    class uint_t<c_bits, digit_t>::Montgomery {
+    public:
+        constexpr explicit Montgomery(const uint_t& value) :
+            m_value(value), m_size(value.actual_size()),
+            m_inverse(algorithm::montgomery::inverse(value[0])) {
+            assert((value[0] & 1) != 0 && "uint_t::Montgomery::Montgomery : modulus must be odd");
+
+            // R mod m, the subtraction wraps around when R = 2^c_bits
+            if (m_size < c_digit_number) {
+                m_square = (uint_t(1) << (m_size * c_digit_size)) % m_value;
+            } else {
+                m_square = (uint_t(0) - m_value) % m_value;
+            }
+
+            // R^2 mod m by doubling R mod m another log2(R) times, once per modulus
+            for (size_t i = 0; i < m_size * c_digit_size; ++i) {
+                const uint_t doubled = m_square + m_square;
+
+                m_square = (doubled < m_square || doubled >= m_value) ? doubled - m_value : doubled;
+            }
+        }
+
+        constexpr const uint_t& value() const {
+            return m_value;
+        }
+
+        // Returns lhs * rhs / R mod m, both operands must be less than m
+        constexpr uint_t multiply(const uint_t& lhs, const uint_t& rhs) const {
+            std::array<digit_t, c_digit_number + 2> product = {};
+            algorithm::montgomery::multiply(lhs.m_digits.data(), rhs.m_digits.data(), m_value.m_digits.data(),
+                                            m_size, m_inverse, product.data());
+
+            uint_t result;
+            std::copy(product.begin(), product.begin() + m_size, result.m_digits.begin());
+            return result;
+        }
+
+        // Returns value * R mod m, value must be less than m
+        constexpr uint_t to_montgomery(const uint_t& value) const {
+            return multiply(value, m_square);
+        }
+
+        // Returns value / R mod m
+        constexpr uint_t from_montgomery(const uint_t& value) const {
+            return multiply(value, uint_t(1));
+        }
+
+        // Returns value / R mod m for value less than k * m * R, which takes up to k subtractions: sums of a
+        // few products of residues are reduced at once
+        constexpr uint_t reduce(const uint_t<2 * c_bits, digit_t>& value) const {
+            std::array<digit_t, 2 * c_digit_number + 1> buffer;
+            const size_t size = std::max(value.actual_size(), 2 * m_size);
+            std::copy(value.m_digits.begin(), value.m_digits.begin() + size, buffer.begin());
+            algorithm::montgomery::reduce(buffer.data(), size, m_value.m_digits.data(), m_size, m_inverse);
+
+            uint_t result;
+            std::copy(buffer.begin() + m_size, buffer.begin() + 2 * m_size, result.m_digits.begin());
+            return result;
+        }
+
+        // Returns value * R, so that reduce(widen(x)) = x
+        constexpr uint_t<2 * c_bits, digit_t> widen(const uint_t& value) const {
+            return uint_t<2 * c_bits, digit_t>(value) << (m_size * c_digit_size);
+        }
+
+    private:
+        uint_t m_value;
+        uint_t m_square;   // R^2 mod m_value
+        size_t m_size = 0;
+        digit_t m_inverse = 0;   // -m_value^-1 mod b
+    };
+
+    template<size_t c_bits, typename digit_t>
+    requires concepts::is_digit<digit_t>
+    class uint_t<c_bits, digit_t>::SpecialModulus {
+    public:
+        enum class Form { NistP256, NistP384, PseudoMersenne };
+
+        // Returns the prepared modulus if value has one of the special forms
+        static constexpr std::optional<SpecialModulus> find(const uint_t& value) {
+            if constexpr (c_bits >= 256) {
+                if (value == uint_t("0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff")) {
+                    return SpecialModulus(value, Form::NistP256, 256);
+                }
+            }
+
+            if constexpr (c_bits >= 384) {
+                if (value == uint_t("0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe"
+                                    "ffffffff0000000000000000ffffffff")) {
+                    return SpecialModulus(value, Form::NistP384, 384);
+                }
+            }
+
+            // offset = 2^bits - value, the subtraction wraps around when bits = c_bits
+            const size_t bits = value.bit_length();
+            uint_t offset = uint_t(0) - value;
+
+            if (bits < c_bits) {
+                offset += uint_t(1) << bits;
+            }
+
+            const size_t offset_bits = offset.bit_length();
+
+            if (bits < 2 || offset_bits > 64 || 2 * offset_bits > bits) {
+                return std::nullopt;
+            }
+
+            SpecialModulus result(value, Form::PseudoMersenne, bits);
+            result.m_offset = offset;
+            result.m_offset_size = offset.actual_size();
+            return result;
+        }
+
+        constexpr const uint_t& value() const {
+            return m_value;
+        }
+
+        constexpr Form form() const {
+            return m_form;
+        }
+
+        // Returns lhs * rhs mod m, both operands must be less than m
+        constexpr uint_t multiply(const uint_t& lhs, const uint_t& rhs) const {
+            product_digits product;
+            algorithm::multiplication::comba(lhs.m_digits.data(), m_size, rhs.m_digits.data(), m_size,
+                                             product.data(), 2 * m_size);
+            return reduce(product, 2 * m_size);
+        }
+
+        // Returns value^2 mod m, value must be less than m
+        constexpr uint_t square(const uint_t& value) const {
+            product_digits product;
+            algorithm::multiplication::comba_square(value.m_digits.data(), m_size, product.data(),
+                                                    2 * m_size);
+            return reduce(product, 2 * m_size);
+        }
+
+        // Returns value mod m for value less than k * m^2, which takes about k extra subtractions: sums of a
+        // few products of residues are reduced at once
+        constexpr uint_t reduce(const uint_t<2 * c_bits, digit_t>& value) const {
+            product_digits product = value.m_digits;
+            return reduce(product, std::max(value.actual_size(), 2 * m_size));
+        }
+
+    private:
+        using product_digits = std::array<digit_t, 2 * c_digit_number>;
+
+        constexpr SpecialModulus(const uint_t& value, Form form, size_t bits) :
+            m_value(value), m_form(form), m_bits(bits), m_size(value.actual_size()) {}
+
+        // product has size >= 2 * m_size digits and is destroyed. Every kernel leaves less than 2^m_bits,
+        // which is less than 2m
+        constexpr uint_t reduce(product_digits& product, size_t size) const {
+            namespace special_reduction = algorithm::special_reduction;
+            const digit_t* modulus = m_value.m_digits.data();
+            uint_t result;
+
+            // The Solinas kernels read only 2 * m_size digits, m * 2^m_bits is subtracted while anything is
+            // left above them
+            if (m_form != Form::PseudoMersenne) {
+                while (std::any_of(product.begin() + 2 * m_size, product.begin() + size,
+                                   [](digit_t digit) { return digit != 0; })) {
+                    digit_t borrow = 0;
+
+                    for (size_t i = 0; i < m_size; ++i) {
+                        product[m_size + i] = algorithm::digit::sub(product[m_size + i], modulus[i], borrow);
+                    }
+
+                    for (size_t i = 2 * m_size; i < size; ++i) {
+                        product[i] = algorithm::digit::sub(product[i], digit_t(0), borrow);
+                    }
+                }
+            }
+
+            if (m_form == Form::NistP256) {
+                special_reduction::reduce_p256(product.data(), modulus, result.m_digits.data());
+            } else if (m_form == Form::NistP384) {
+                special_reduction::reduce_p384(product.data(), modulus, result.m_digits.data());
+            } else {
+                product_digits buffer;
+                const digit_t* offset = m_offset.m_digits.data();
+                special_reduction::fold_pseudo_mersenne(product.data(), size, m_bits, offset,
+                                                        m_offset_size, buffer.data());
+                std::copy(product.begin(), product.begin() + m_size, result.m_digits.begin());
+            }
+
+            if (result >= m_value) {
+                result -= m_value;
+            }
+
+            return result;
+        }
+
+        uint_t m_value;
+        Form m_form;
+        size_t m_bits = 0;
+        size_t m_size = 0;
+        uint_t m_offset;   // 2^m_bits - m_value for PseudoMersenne
+        size_t m_offset_size = 0;
+    };
 }   // namespace elliptic_curve_guide
 
 #endif
@@ -0,0 +1,333 @@
+#ifndef ECG_STATIC_FIELD_H
+#define ECG_STATIC_FIELD_H
+
+#include "uint.h"
+
+#ifndef ECG_USE_BOOST
+    #include "utils/fast-pow.h"
+    #include "utils/field_root.h"
+    #include "utils/jacobi-symbol.h"
+
+    #include <algorithm>
+    #include <cassert>
+    #include <compare>
+    #include <optional>
+    #include <type_traits>
+
+namespace elliptic_curve_guide {
+    namespace field {
+        // A prime written as a template argument, StaticField<"0xffffffff00000001..."> names the field
+        template<size_t c_size>
+        struct StaticModulus {
+            consteval StaticModulus(const char (&str)[c_size]) {
+                std::copy_n(str, c_size, string);
+            }
+
+            char string[c_size];
+        };
+
+        // The reduction of StaticField<p>, chosen and prepared by the compiler. Values are kept in one digit
+        // more than the prime needs, so a sum of two elements never overflows and the Accumulator has room
+        // for several products. Special primes reduce by their own kernels, the rest in Montgomery form.
+        // Elements take and return uint_type: uint for primes that fit into it, P-521 and other wider ones
+        // in the fewest digits
+        template<StaticModulus p>
+        struct CompileTimeModulus {
+            using digit_t = algorithm::digit::native_digit_t;
+
+            // Every symbol of the literal, hexadecimal or decimal, stands for at most four bits
+            static constexpr size_t c_literal_bits = ((sizeof(p.string) - 1) * 4 / 64 + 1) * 64;
+            static constexpr size_t c_bit_length = uint_t<c_literal_bits, digit_t>(p.string).bit_length();
+
+            using uint_type = std::conditional_t<c_bit_length <= uint_info::uint_bits_number, uint,
+                                                 uint_t<(c_bit_length + 63) / 64 * 64, digit_t>>;
+
+            static constexpr uint_type c_value = uint_type(p.string);
+            static_assert(c_value.test_bit(0) && c_value > 2,
+                          "CompileTimeModulus : modulus must be an odd prime");
+
+            static constexpr size_t c_bits = (c_bit_length / 64 + 1) * 64;
+
+            using value_type = uint_t<c_bits, digit_t>;
+            using wide_type = uint_t<2 * c_bits, digit_t>;
+            using Special = typename value_type::SpecialModulus;
+            using Montgomery = typename value_type::Montgomery;
+
+            static constexpr value_type c_modulus = value_type(c_value);
+            static constexpr std::optional<Special> c_special = Special::find(c_modulus);
+            static constexpr bool c_is_special = c_special.has_value();
+            static constexpr Montgomery c_montgomery = Montgomery(c_modulus);
+            static constexpr value_type c_one = c_is_special ? value_type(1) : c_montgomery.to_montgomery(1);
+
+            static constexpr value_type encode(const value_type& value) {
+                if constexpr (c_is_special) {
+                    return value;
+                } else {
+                    return c_montgomery.to_montgomery(value);
+                }
+            }
+
+            static constexpr value_type decode(const value_type& value) {
+                if constexpr (c_is_special) {
+                    return value;
+                } else {
+                    return c_montgomery.from_montgomery(value);
+                }
+            }
+
+            static constexpr value_type multiply(const value_type& lhs, const value_type& rhs) {
+                if constexpr (c_is_special) {
+                    return c_special->multiply(lhs, rhs);
+                } else {
+                    return c_montgomery.multiply(lhs, rhs);
+                }
+            }
+
+            static constexpr value_type square(const value_type& value) {
+                if constexpr (c_is_special) {
+                    return c_special->square(value);
+                } else {
+                    return c_montgomery.multiply(value, value);
+                }
+            }
+
+            static constexpr value_type inverse(const value_type& value) {
+                return encode(inverse_odd_modulo(decode(value), c_modulus));
+            }
+
+            // reduce(mul_wide(x, y)) is the same as multiply(x, y), and reduce(widen(x)) = x
+            static constexpr value_type reduce(const wide_type& value) {
+                if constexpr (c_is_special) {
+                    return c_special->reduce(value);
+                } else {
+                    return c_montgomery.reduce(value);
+                }
+            }
+
+            static constexpr wide_type widen(const value_type& value) {
+                if constexpr (c_is_special) {
+                    return wide_type(value);
+                } else {
+                    return c_montgomery.widen(value);
+                }
+            }
+        };
+
+        template<StaticModulus p>
+        class StaticField;
+
+        // An element of StaticField<p>: the same interface as FieldElement, but the modulus is a part of the
+        // type, so an element is only its value and every reduction constant is known to the compiler
+        template<StaticModulus p>
+        class StaticFieldElement {
+            friend class StaticField<p>;
+
+            using Modulus = CompileTimeModulus<p>;
+            using uint_type = typename Modulus::uint_type;
+            using value_type = typename Modulus::value_type;
+            using wide_type = typename Modulus::wide_type;
+
+            constexpr explicit StaticFieldElement(const value_type& value) : m_value(value) {}
+
+        public:
+            // A sum of products of elements that is reduced once, when it is read
+            class Accumulator {
+            public:
+                constexpr Accumulator(const StaticFieldElement& lhs, const StaticFieldElement& rhs) :
+                    m_value(mul_wide(lhs.m_value, rhs.m_value)) {}
+
+                constexpr Accumulator& add(const StaticFieldElement& element) {
+                    const wide_type sum = m_value + Modulus::widen(element.m_value);
+                    assert(sum >= m_value && "StaticFieldElement::Accumulator::add : too many terms");
+                    m_value = sum;
+                    return *this;
+                }
+
+                constexpr Accumulator& subtract(const StaticFieldElement& element) {
+                    return add(-element);
+                }
+
+                constexpr Accumulator& add_product(const StaticFieldElement& lhs,
+                                                   const StaticFieldElement& rhs) {
+                    add_mul_wide(m_value, lhs.m_value, rhs.m_value);
+                    return *this;
+                }
+
+                // x * y is subtracted as x * (m - y), every term stays non-negative
+                constexpr Accumulator& subtract_product(const StaticFieldElement& lhs,
+                                                        const StaticFieldElement& rhs) {
+                    return add_product(lhs, -rhs);
+                }
+
+                constexpr StaticFieldElement reduce() const {
+                    return StaticFieldElement(Modulus::reduce(m_value));
+                }
+
+            private:
+                wide_type m_value;
+            };
+
+            static constexpr StaticFieldElement inverse(const StaticFieldElement& element) {
+                StaticFieldElement result = element;
+                result.inverse();
+                return result;
+            }
+
+            static StaticFieldElement pow(const StaticFieldElement& element, const uint_type& power) {
+                if (power == 0) {
+                    return StaticFieldElement(Modulus::c_one);
+                }
+
+                return algorithm::fast_pow<StaticFieldElement, uint_type>(element, power);
+            }
+
+            static StaticFieldElement pow(const StaticFieldElement& element,
+                                          const algorithm::PowerPlan& plan) {
+                if (plan.power() == 0) {
+                    return StaticFieldElement(Modulus::c_one);
+                }
+
+                return StaticFieldElement(plan.run(element.m_value, Modulus::multiply, Modulus::square));
+            }
+
+            static constexpr StaticFieldElement square(const StaticFieldElement& element) {
+                return StaticFieldElement(Modulus::square(element.m_value));
+            }
+
+            static constexpr StaticFieldElement cube(const StaticFieldElement& element) {
+                return square(element) * element;
+            }
+
+            friend constexpr StaticFieldElement operator+(StaticFieldElement lhs,
+                                                          const StaticFieldElement& rhs) {
+                return lhs += rhs;
+            }
+
+            friend constexpr StaticFieldElement operator-(StaticFieldElement lhs,
+                                                          const StaticFieldElement& rhs) {
+                return lhs -= rhs;
+            }
+
+            friend constexpr StaticFieldElement operator*(StaticFieldElement lhs,
+                                                          const StaticFieldElement& rhs) {
+                return lhs *= rhs;
+            }
+
+            friend constexpr StaticFieldElement operator/(StaticFieldElement lhs,
+                                                          const StaticFieldElement& rhs) {
+                return lhs /= rhs;
+            }
+
+            friend constexpr StaticFieldElement operator<<(StaticFieldElement value, const uint_type& shift) {
+                return value <<= shift;
+            }
+
+            constexpr StaticFieldElement operator-() const {
+                return is_invertible() ? StaticFieldElement(Modulus::c_modulus - m_value) : *this;
+            }
+
+            constexpr StaticFieldElement& operator+=(const StaticFieldElement& other) {
+                m_value += other.m_value;
+
+                if (m_value >= Modulus::c_modulus) {
+                    m_value -= Modulus::c_modulus;
+                }
+
+                return *this;
+            }
+
+            constexpr StaticFieldElement& operator-=(const StaticFieldElement& other) {
+                if (m_value < other.m_value) {
+                    m_value += Modulus::c_modulus;
+                }
+
+                m_value -= other.m_value;
+                return *this;
+            }
+
+            constexpr StaticFieldElement& operator*=(const StaticFieldElement& other) {
+                m_value = Modulus::multiply(m_value, other.m_value);
+                return *this;
+            }
+
+            constexpr StaticFieldElement& operator/=(const StaticFieldElement& other) {
+                return (*this *= inverse(other));
+            }
+
+            // Doubles by addition, which works on m_value in the form Modulus keeps it in
+            constexpr StaticFieldElement& operator<<=(const uint_type& shift) {
+                for (uint_type i = 0; i < shift; ++i) {
+                    *this += *this;
+                }
+
+                return *this;
+            }
+
+            friend constexpr bool operator==(const StaticFieldElement& lhs, const StaticFieldElement& rhs) {
+                return lhs.m_value == rhs.m_value;
+            }
+
+            friend constexpr std::strong_ordering operator<=>(const StaticFieldElement& lhs,
+                                                              const StaticFieldElement& rhs) {
+                return lhs.value() <=> rhs.value();
+            }
+
+            constexpr bool is_invertible() const {
+                return m_value != 0;
+            }
+
+            // Legendre symbol: 1 for non-zero squares, -1 for non-squares, 0 for zero
+            constexpr int jacobi_symbol() const {
+                return is_invertible() ? binary_jacobi(Modulus::decode(m_value), Modulus::c_modulus) : 0;
+            }
+
+            void pow(const uint_type& power) {
+                *this = pow(*this, power);
+            }
+
+            constexpr void inverse() {
+                m_value = Modulus::inverse(m_value);
+            }
+
+            constexpr const uint_type& modulus() const {
+                return Modulus::c_value;
+            }
+
+            constexpr uint_type value() const {
+                return uint_type(Modulus::decode(m_value));
+            }
+
+        private:
+            value_type m_value;
+        };
+
+        // The field of integers modulo an odd prime p fixed at compile time. It holds no state, so it is free
+        // to copy and compare, and plugs into the curve, ECDSA and ElGamal templates in place of Field
+        template<StaticModulus p>
+        class StaticField {
+        public:
+            using uint_type = typename CompileTimeModulus<p>::uint_type;
+            using Element = StaticFieldElement<p>;
+
+            constexpr Element element(const uint_type& value) const {
+                using Modulus = CompileTimeModulus<p>;
+                const uint_type reduced = value < Modulus::c_value ? value : value % Modulus::c_value;
+                return Element(Modulus::encode(typename Modulus::value_type(reduced)));
+            }
+
+            constexpr const uint_type& modulus() const {
+                return CompileTimeModulus<p>::c_value;
+            }
+
+            constexpr bool operator==(const StaticField& other) const = default;
+
+            // Built by the first call, once per program
+            const algorithm::BasicSqrtContext<StaticField>& sqrt_context() const {
+                static const algorithm::BasicSqrtContext<StaticField> context(*this);
+                return context;
+            }
+        };
+    }   // namespace field
+}   // namespace elliptic_curve_guide
+#endif
+#endif
@@ -16,12 +16,57 @@ namespace elliptic_curve_guide {
 
 namespace elliptic_curve_guide {
     using uint = boost::multiprecision::uint512_t;
+    using wide_uint = boost::multiprecision::uint1024_t;
+    using wide_uint_barrett = wide_uint;
+
+    inline wide_uint mul_wide(const uint& lhs, const uint& rhs) {
+        wide_uint result;
+        boost::multiprecision::multiply(result, lhs, rhs);
+        return result;
+    }
+
+    inline wide_uint square_wide(const uint& value) {
+        return mul_wide(value, value);
+    }
+
+    inline void add_mul_wide(wide_uint& result, const uint& lhs, const uint& rhs) {
+        result += mul_wide(lhs, rhs);
+    }
+
+    // The type of products of two values and its prepared Barrett modulus
+    template<typename T>
+    struct uint_traits;
+
+    template<>
+    struct uint_traits<uint> {
+        static constexpr size_t bits = uint_info::uint_bits_number;
+        using wide = wide_uint;
+        using barrett = wide_uint_barrett;
+    };
 }   // namespace elliptic_curve_guide
 #else
     #include "long-arithmetic.h"
 
 namespace elliptic_curve_guide {
-    using uint = uint_t<512>;
+    using uint = uint_t<uint_info::uint_bits_number, algorithm::digit::native_digit_t>;
+    using wide_uint = uint_t<2 * uint_info::uint_bits_number, algorithm::digit::native_digit_t>;
+    using wide_uint_barrett = wide_uint::Barrett;
+
+    // Narrower and wider fields than uint: P-256, P-384 and P-521 in the fewest digits
+    using uint256 = uint_t<256, algorithm::digit::native_digit_t>;
+    using uint384 = uint_t<384, algorithm::digit::native_digit_t>;
+    using uint576 = uint_t<576, algorithm::digit::native_digit_t>;
+
+    // The type of products of two values and its prepared Barrett modulus
+    template<typename T>
+    struct uint_traits;
+
+    template<size_t c_bits, typename digit_t>
+    struct uint_traits<uint_t<c_bits, digit_t>> {
+        static constexpr size_t bits = c_bits;
+        using wide = uint_t<2 * c_bits, digit_t>;
+        using barrett = typename wide::Barrett;
+    };
 }   // namespace elliptic_curve_guide
 #endif
 #endif
@@ -0,0 +1,348 @@
+#ifndef ECG_BINARY_GCD_H
+#define ECG_BINARY_GCD_H
+
+#include "digit-arithmetic.h"
+#include "montgomery.h"
+#include "multiplication.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace elliptic_curve_guide {
+    namespace algorithm {
+        namespace binary_gcd {
+            // Steps of the binary GCD done on 64-bit approximations before the long values are updated, the
+            // update factors stay within 2^31 and fit into any digit
+            constexpr size_t c_batch_size = 31;
+            constexpr size_t c_approximation_size = 64;
+
+            // Upper bound of the buffer used by inverse for a modulus of size digits
+            constexpr size_t buffer_size(size_t size) {
+                return 7 * (size + 2);
+            }
+
+            // a' = (f0 a + g0 b) / 2^31 and b' = (f1 a + g1 b) / 2^31
+            struct Factors {
+                int64_t f0 = 1;
+                int64_t g0 = 0;
+                int64_t f1 = 0;
+                int64_t g1 = 1;
+            };
+
+            // Pornin, "Optimized Binary GCD for Modular Inversion": c_batch_size steps on a and b, b is odd.
+            // The low 31 bits of the approximations are exact, so every parity is right, the top bits only
+            // guide the comparisons
+            constexpr Factors run_batch(uint64_t a, uint64_t b) {
+                Factors result;
+
+                for (size_t i = 0; i < c_batch_size; ++i) {
+                    if ((a & 1) != 0) {
+                        if (a < b) {
+                            std::swap(a, b);
+                            std::swap(result.f0, result.f1);
+                            std::swap(result.g0, result.g1);
+                        }
+
+                        a -= b;
+                        result.f0 -= result.f1;
+                        result.g0 -= result.g1;
+                    }
+
+                    a >>= 1;
+                    result.f1 <<= 1;
+                    result.g1 <<= 1;
+                }
+
+                return result;
+            }
+
+            // Number of significant bits of a value of size digits
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr size_t bit_length(const digit_t* value, size_t size) {
+                while (size > 0 && value[size - 1] == 0) {
+                    --size;
+                }
+
+                if (size == 0) {
+                    return 0;
+                }
+
+                const size_t top_bits = static_cast<size_t>(std::bit_width(value[size - 1]));
+                return (size - 1) * digit::c_digit_size<digit_t> + top_bits;
+            }
+
+            // Bits [pos, pos + 64) of a value of size digits, bits past the end are zeros
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr uint64_t extract_bits(const digit_t* value, size_t size, size_t pos) {
+                constexpr size_t c_digit_size = digit::c_digit_size<digit_t>;
+                const size_t index = pos / c_digit_size;
+                const size_t offset = pos % c_digit_size;
+                uint64_t result = 0;
+
+                for (size_t i = index, shift = 0; i < size && shift < c_approximation_size + offset;
+                     ++i, shift += c_digit_size) {
+                    const uint64_t part = static_cast<uint64_t>(value[i]);
+
+                    if (shift >= offset) {
+                        result |= part << (shift - offset);
+                    } else {
+                        result |= part >> (offset - shift);
+                    }
+                }
+
+                return result;
+            }
+
+            // Writes |lhs * lhs_factor + rhs * rhs_factor| into size + 1 digits of result, returns true if
+            // the sum is negative. Operands have size digits, buffer holds size + 1 digits
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr bool combine(const digit_t* lhs, int64_t lhs_factor, const digit_t* rhs,
+                                   int64_t rhs_factor, size_t size, digit_t* result, digit_t* buffer) {
+                const bool is_lhs_negative = lhs_factor < 0;
+                const bool is_rhs_negative = rhs_factor < 0;
+                const auto lhs_multiplier = static_cast<digit_t>(is_lhs_negative ? -lhs_factor : lhs_factor);
+                const auto rhs_multiplier = static_cast<digit_t>(is_rhs_negative ? -rhs_factor : rhs_factor);
+                digit_t lhs_carry = 0;
+                digit_t rhs_carry = 0;
+
+                for (size_t i = 0; i < size; ++i) {
+                    result[i] = digit::mul_add(lhs[i], lhs_multiplier, digit_t(0), lhs_carry);
+                    buffer[i] = digit::mul_add(rhs[i], rhs_multiplier, digit_t(0), rhs_carry);
+                }
+
+                result[size] = lhs_carry;
+                buffer[size] = rhs_carry;
+
+                if (is_lhs_negative == is_rhs_negative) {
+                    digit_t carry = 0;
+
+                    for (size_t i = 0; i <= size; ++i) {
+                        result[i] = digit::add(result[i], buffer[i], carry);
+                    }
+
+                    return is_lhs_negative;
+                }
+
+                return multiplication::subtract_absolute(result, buffer, size + 1, result) != is_lhs_negative;
+            }
+
+            // Writes value / 2^31 of size + 1 digits into size digits of result
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr void shift_batch(const digit_t* value, size_t size, digit_t* result) {
+                constexpr size_t c_digit_size = digit::c_digit_size<digit_t>;
+
+                for (size_t i = 0; i < size; ++i) {
+                    result[i] = (value[i] >> c_batch_size) | (value[i + 1] << (c_digit_size - c_batch_size));
+                }
+            }
+
+            // Returns true if value of size + 1 digits is less than modulus of size digits
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr bool is_less(const digit_t* value, const digit_t* modulus, size_t size) {
+                if (value[size] != 0) {
+                    return false;
+                }
+
+                size_t pos = size;
+
+                while (pos > 0 && value[pos - 1] == modulus[pos - 1]) {
+                    --pos;
+                }
+
+                return pos > 0 && value[pos - 1] < modulus[pos - 1];
+            }
+
+            // Writes value / 2^31 mod modulus into size digits of result, value has size + 2 digits, is less
+            // than 2^32 modulus and is destroyed. inverse is montgomery::inverse(modulus[0])
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr void halve_batch(digit_t* value, const digit_t* modulus, size_t size, digit_t inverse,
+                                       digit_t* result) {
+                // Adding factor * modulus clears the low 31 bits, after the shift the sum is less than
+                // 3 * modulus
+                const digit_t mask = (static_cast<digit_t>(1) << c_batch_size) - 1;
+                const digit_t factor = (value[0] * inverse) & mask;
+                digit_t carry = 0;
+
+                for (size_t i = 0; i < size; ++i) {
+                    value[i] = digit::mul_add(factor, modulus[i], value[i], carry);
+                }
+
+                digit_t top_carry = 0;
+                value[size] = digit::add(value[size], carry, top_carry);
+                value[size + 1] += top_carry;
+                shift_batch(value, size + 1, value);
+
+                while (!is_less(value, modulus, size)) {
+                    digit_t borrow = 0;
+
+                    for (size_t i = 0; i < size; ++i) {
+                        value[i] = digit::sub(value[i], modulus[i], borrow);
+                    }
+
+                    value[size] -= borrow;
+                }
+
+                std::copy(value, value + size, result);
+            }
+
+            // Writes value^-1 mod modulus into size digits of result. The modulus is odd and has size digits,
+            // value is less than modulus and coprime to it, buffer holds buffer_size(size) digits.
+            // Invariants: value * u = a and value * v = b modulo modulus, the batches shrink a and b until a
+            // vanishes and b is their GCD
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr void inverse(const digit_t* value, const digit_t* modulus, size_t size, digit_t* result,
+                                   digit_t* buffer) {
+                constexpr uint64_t c_low_mask = (static_cast<uint64_t>(1) << c_batch_size) - 1;
+                const size_t length = size + 2;
+                digit_t* a = buffer;
+                digit_t* b = a + length;
+                digit_t* u = b + length;
+                digit_t* v = u + length;
+                digit_t* first = v + length;
+                digit_t* second = first + length;
+                digit_t* scratch = second + length;
+                std::fill(buffer, buffer + buffer_size(size), digit_t(0));
+                std::copy(value, value + size, a);
+                std::copy(modulus, modulus + size, b);
+                u[0] = 1;
+
+                const digit_t inverse = montgomery::inverse(modulus[0]);
+                size_t active_size = size;
+
+                while (bit_length(a, active_size) != 0) {
+                    // a and b never grow, so the digits above both of them stay zero
+                    while (active_size > 1 && a[active_size - 1] == 0 && b[active_size - 1] == 0) {
+                        --active_size;
+                    }
+
+                    // The low 31 bits and the top 33 bits of the longer value
+                    const size_t bits = std::max(
+                        {bit_length(a, active_size), bit_length(b, active_size), c_approximation_size});
+                    const size_t top_pos = bits - (c_approximation_size - c_batch_size);
+                    const uint64_t a_approximation = (extract_bits(a, active_size, top_pos) << c_batch_size)
+                                                   | (extract_bits(a, active_size, 0) & c_low_mask);
+                    const uint64_t b_approximation = (extract_bits(b, active_size, top_pos) << c_batch_size)
+                                                   | (extract_bits(b, active_size, 0) & c_low_mask);
+                    Factors factors = run_batch(a_approximation, b_approximation);
+
+                    // Wrong comparisons of the approximations may make a or b negative, the signs are moved
+                    // into the factors
+                    if (combine(a, factors.f0, b, factors.g0, active_size, first, scratch)) {
+                        factors.f0 = -factors.f0;
+                        factors.g0 = -factors.g0;
+                    }
+
+                    if (combine(a, factors.f1, b, factors.g1, active_size, second, scratch)) {
+                        factors.f1 = -factors.f1;
+                        factors.g1 = -factors.g1;
+                    }
+
+                    shift_batch(first, active_size, a);
+                    shift_batch(second, active_size, b);
+
+                    // u and v follow with the division by 2^31 done modulo modulus
+                    std::fill(first, first + length, digit_t(0));
+                    std::fill(second, second + length, digit_t(0));
+                    const bool is_u_negative = combine(u, factors.f0, v, factors.g0, size, first, scratch);
+                    const bool is_v_negative = combine(u, factors.f1, v, factors.g1, size, second, scratch);
+                    halve_batch(first, modulus, size, inverse, u);
+                    halve_batch(second, modulus, size, inverse, v);
+
+                    if (is_u_negative && bit_length(u, size) != 0) {
+                        multiplication::subtract_absolute(modulus, u, size, u);
+                    }
+
+                    if (is_v_negative && bit_length(v, size) != 0) {
+                        multiplication::subtract_absolute(modulus, v, size, v);
+                    }
+                }
+
+                std::copy(v, v + size, result);
+            }
+
+            // Jacobi symbol (value / modulus) for an odd modulus, both have size digits and value is less
+            // than modulus, buffer holds 2 * size digits. Binary algorithm: a is made odd by shifts, a shift
+            // by an odd count flips the sign if b = 3, 5 mod 8. The smaller odd value is then subtracted
+            // from the larger, and putting b in the place of a flips the sign if both are 3 mod 4
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr int jacobi(const digit_t* value, const digit_t* modulus, size_t size, digit_t* buffer) {
+                constexpr size_t c_digit_size = digit::c_digit_size<digit_t>;
+                digit_t* a = buffer;
+                digit_t* b = a + size;
+                std::copy(value, value + size, a);
+                std::copy(modulus, modulus + size, b);
+                int result = 1;
+
+                for (;;) {
+                    while (size > 0 && a[size - 1] == 0 && b[size - 1] == 0) {
+                        --size;
+                    }
+
+                    size_t zero_digits = 0;
+
+                    while (zero_digits < size && a[zero_digits] == 0) {
+                        ++zero_digits;
+                    }
+
+                    if (zero_digits == size) {
+                        break;
+                    }
+
+                    const size_t zero_bits = static_cast<size_t>(std::countr_zero(a[zero_digits]));
+
+                    if (zero_digits != 0 || zero_bits != 0) {
+                        for (size_t i = 0; i + zero_digits < size; ++i) {
+                            const digit_t next = i + zero_digits + 1 < size ? a[i + zero_digits + 1] : 0;
+                            a[i] = zero_bits == 0 ? a[i + zero_digits]
+                                                  : (a[i + zero_digits] >> zero_bits)
+                                                        | (next << (c_digit_size - zero_bits));
+                        }
+
+                        std::fill(a + size - zero_digits, a + size, digit_t(0));
+
+                        const digit_t b_low = b[0] & 7;
+
+                        if ((zero_digits * c_digit_size + zero_bits) % 2 != 0 && (b_low == 3 || b_low == 5)) {
+                            result = -result;
+                        }
+                    }
+
+                    size_t pos = size;
+
+                    while (pos > 0 && a[pos - 1] == b[pos - 1]) {
+                        --pos;
+                    }
+
+                    if (pos > 0 && a[pos - 1] < b[pos - 1]) {
+                        std::swap(a, b);
+
+                        if ((a[0] & 3) == 3 && (b[0] & 3) == 3) {
+                            result = -result;
+                        }
+                    }
+
+                    digit_t borrow = 0;
+
+                    for (size_t i = 0; i < size; ++i) {
+                        a[i] = digit::sub(a[i], b[i], borrow);
+                    }
+                }
+
+                // b is the GCD now
+                return bit_length(b, size) == 1 ? result : 0;
+            }
+        }   // namespace binary_gcd
+    }       // namespace algorithm
+}   // namespace elliptic_curve_guide
+#endif
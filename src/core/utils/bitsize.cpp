@@ -1,14 +1,52 @@
 #include "bitsize.h"
 
+#include <cassert>
+
 namespace elliptic_curve_guide::algorithm {
-    size_t actual_bit_size(uint value) {
-        size_t result = 0;
+    size_t actual_bit_size(const uint& value) {
+#ifdef ECG_USE_BOOST
+        return value == 0 ? 0 : boost::multiprecision::msb(value) + 1;
+#else
+        return value.bit_length();
+#endif
+    }
+
+    size_t count_trailing_zeros(const uint& value) {
+#ifdef ECG_USE_BOOST
+        return value == 0 ? uint_info::uint_bits_number : boost::multiprecision::lsb(value);
+#else
+        return value.countr_zero();
+#endif
+    }
+
+    bool test_bit(const uint& value, size_t pos) {
+#ifdef ECG_USE_BOOST
+        return pos < uint_info::uint_bits_number && boost::multiprecision::bit_test(value, pos);
+#else
+        return value.test_bit(pos);
+#endif
+    }
 
-        while (value != 0) {
-            ++result;
-            value >>= 1;
-        }
+    uint32_t extract_bits(const uint& value, size_t pos, size_t width) {
+        assert(width <= 32 && "extract_bits : width must be at most 32");
+#ifdef ECG_USE_BOOST
+        return ((value >> pos) & ((uint(1) << width) - 1)).convert_to<uint32_t>();
+#else
+        return static_cast<uint32_t>(value.extract_bits(pos, width));
+#endif
+    }
+#ifdef ECG_USE_BOOST
+    size_t actual_bit_size(const wide_uint& value) {
+        return value == 0 ? 0 : boost::multiprecision::msb(value) + 1;
+    }
+
+    bool test_bit(const wide_uint& value, size_t pos) {
+        return pos < 2 * uint_info::uint_bits_number && boost::multiprecision::bit_test(value, pos);
+    }
 
-        return result;
+    uint32_t extract_bits(const wide_uint& value, size_t pos, size_t width) {
+        assert(width <= 32 && "extract_bits : width must be at most 32");
+        return ((value >> pos) & ((wide_uint(1) << width) - 1)).convert_to<uint32_t>();
     }
+#endif
 }   // namespace elliptic_curve_guide::algorithm
@@ -3,9 +3,48 @@
 
 #include "uint.h"
 
+#include <cassert>
+#include <cstdint>
+
 namespace elliptic_curve_guide {
     namespace algorithm {
-        size_t actual_bit_size(uint value);
+        size_t actual_bit_size(const uint& value);
+
+        // Number of trailing zero bits, uint_info::uint_bits_number for zero
+        size_t count_trailing_zeros(const uint& value);
+
+        bool test_bit(const uint& value, size_t pos);
+
+        // Bits [pos, pos + width) of value, width is at most 32
+        uint32_t extract_bits(const uint& value, size_t pos, size_t width);
+#ifdef ECG_USE_BOOST
+        // The same for powers of up to twice the width
+        size_t actual_bit_size(const wide_uint& value);
+        bool test_bit(const wide_uint& value, size_t pos);
+        uint32_t extract_bits(const wide_uint& value, size_t pos, size_t width);
+#else
+        // The same for the other widths of uint_t
+        template<size_t c_bits, typename digit_t>
+        size_t actual_bit_size(const uint_t<c_bits, digit_t>& value) {
+            return value.bit_length();
+        }
+
+        template<size_t c_bits, typename digit_t>
+        size_t count_trailing_zeros(const uint_t<c_bits, digit_t>& value) {
+            return value.countr_zero();
+        }
+
+        template<size_t c_bits, typename digit_t>
+        bool test_bit(const uint_t<c_bits, digit_t>& value, size_t pos) {
+            return value.test_bit(pos);
+        }
+
+        template<size_t c_bits, typename digit_t>
+        uint32_t extract_bits(const uint_t<c_bits, digit_t>& value, size_t pos, size_t width) {
+            assert(width <= 32 && "extract_bits : width must be at most 32");
+            return static_cast<uint32_t>(value.extract_bits(pos, width));
+        }
+#endif
     }   // namespace algorithm
 }   // namespace elliptic_curve_guide
 #endif
@@ -0,0 +1,87 @@
+#ifndef ECG_CHACHA20_H
+#define ECG_CHACHA20_H
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace elliptic_curve_guide {
+    namespace algorithm {
+        // The ChaCha20 block function of RFC 8439: a key stream of 64-byte blocks for a 256-bit key, a 96-bit
+        // nonce and a 32-bit block counter. When the counter wraps, the first word of the nonce is increased,
+        // as in the 64-bit counter of the original ChaCha, so a generator never repeats its stream
+        class ChaCha20 {
+        public:
+            static constexpr size_t c_block_size = 64;
+
+            using Key = std::array<uint32_t, 8>;
+            using Nonce = std::array<uint32_t, 3>;
+
+            constexpr ChaCha20(const Key& key, const Nonce& nonce, uint32_t counter = 0) {
+                m_state[0] = 0x61707865;
+                m_state[1] = 0x3320646e;
+                m_state[2] = 0x79622d32;
+                m_state[3] = 0x6b206574;
+
+                for (size_t i = 0; i < key.size(); ++i) {
+                    m_state[4 + i] = key[i];
+                }
+
+                m_state[12] = counter;
+
+                for (size_t i = 0; i < nonce.size(); ++i) {
+                    m_state[13 + i] = nonce[i];
+                }
+            }
+
+            // Writes the block of the current counter in little-endian order and moves to the next one
+            constexpr void generate(std::span<uint8_t, c_block_size> block) {
+                std::array<uint32_t, c_state_size> x = m_state;
+
+                for (size_t round = 0; round < c_rounds; round += 2) {
+                    quarter_round(x, 0, 4, 8, 12);
+                    quarter_round(x, 1, 5, 9, 13);
+                    quarter_round(x, 2, 6, 10, 14);
+                    quarter_round(x, 3, 7, 11, 15);
+                    quarter_round(x, 0, 5, 10, 15);
+                    quarter_round(x, 1, 6, 11, 12);
+                    quarter_round(x, 2, 7, 8, 13);
+                    quarter_round(x, 3, 4, 9, 14);
+                }
+
+                for (size_t i = 0; i < c_state_size; ++i) {
+                    const uint32_t word = x[i] + m_state[i];
+
+                    for (size_t j = 0; j < 4; ++j) {
+                        block[4 * i + j] = static_cast<uint8_t>(word >> (8 * j));
+                    }
+                }
+
+                if (++m_state[12] == 0) {
+                    ++m_state[13];
+                }
+            }
+
+        private:
+            static constexpr size_t c_state_size = 16;
+            static constexpr size_t c_rounds = 20;
+
+            static constexpr void quarter_round(std::array<uint32_t, c_state_size>& x, size_t a, size_t b,
+                                                size_t c, size_t d) {
+                x[a] += x[b];
+                x[d] = std::rotl(x[d] ^ x[a], 16);
+                x[c] += x[d];
+                x[b] = std::rotl(x[b] ^ x[c], 12);
+                x[a] += x[b];
+                x[d] = std::rotl(x[d] ^ x[a], 8);
+                x[c] += x[d];
+                x[b] = std::rotl(x[b] ^ x[c], 7);
+            }
+
+            std::array<uint32_t, c_state_size> m_state;
+        };
+    }   // namespace algorithm
+}   // namespace elliptic_curve_guide
+#endif
@@ -2,6 +2,7 @@
 #define ECG_CONCEPTS_H
 
 #include <concepts>
+#include <cstdint>
 
 namespace elliptic_curve_guide {
     namespace concepts {
@@ -27,6 +28,9 @@ namespace elliptic_curve_guide {
             f(0);
             p + t;
         };
+
+        template<typename T>
+        concept is_digit = std::same_as<T, uint32_t> || std::same_as<T, uint64_t>;
     }   // namespace concepts
 }   // namespace elliptic_curve_guide
 #endif
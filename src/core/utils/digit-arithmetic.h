@@ -0,0 +1,419 @@
+#ifndef ECG_DIGIT_ARITHMETIC_H
+#define ECG_DIGIT_ARITHMETIC_H
+
+#include "concepts.h"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#ifdef __SIZEOF_INT128__
+    #define ECG_HAS_INT128
+#endif
+
+// Carry chains and 64-bit products written with comparisons and shifts are not reliably turned into
+// adc/sbb/mul, so runtime code goes through the compiler intrinsics when they exist
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+    #include <intrin.h>
+    #define ECG_HAS_ADDCARRY_INTRINSICS
+    #define ECG_HAS_UMUL128_INTRINSICS
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+    #include <x86intrin.h>
+    #define ECG_HAS_ADDCARRY_INTRINSICS
+#endif
+
+#if !defined(ECG_HAS_ADDCARRY_INTRINSICS) && defined(__has_builtin)
+    #if __has_builtin(__builtin_addcll) && __has_builtin(__builtin_subcll)
+        #define ECG_HAS_ADDC_BUILTINS
+    #endif
+#endif
+
+namespace elliptic_curve_guide {
+    namespace algorithm {
+        namespace digit {
+            template<typename digit_t>
+            struct DoubleDigit {
+                using type = void;
+            };
+
+            template<>
+            struct DoubleDigit<uint32_t> {
+                using type = uint64_t;
+            };
+
+#ifdef ECG_HAS_INT128
+            template<>
+            struct DoubleDigit<uint64_t> {
+                using type = unsigned __int128;
+            };
+#endif
+
+            template<typename digit_t>
+            using double_digit_t = typename DoubleDigit<digit_t>::type;
+
+            template<typename digit_t>
+            constexpr bool c_has_double_digit = !std::is_void_v<double_digit_t<digit_t>>;
+
+            template<typename digit_t>
+            constexpr size_t c_digit_size = sizeof(digit_t) * 8;
+
+            // Widest digit with a native double digit or a native wide product, used by the library-wide uint
+#if defined(ECG_HAS_INT128) || defined(ECG_HAS_UMUL128_INTRINSICS)
+            using native_digit_t = uint64_t;
+#else
+            using native_digit_t = uint32_t;
+#endif
+
+            // Returns lhs + rhs + carry, carry becomes the outgoing carry
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr digit_t add(digit_t lhs, digit_t rhs, digit_t& carry) {
+                if (!std::is_constant_evaluated()) {
+#if defined(ECG_HAS_ADDCARRY_INTRINSICS)
+                    if constexpr (sizeof(digit_t) == sizeof(unsigned long long)) {
+                        unsigned long long sum = 0;
+                        carry = _addcarry_u64(static_cast<unsigned char>(carry), lhs, rhs, &sum);
+                        return static_cast<digit_t>(sum);
+                    } else {
+                        unsigned int sum = 0;
+                        carry = _addcarry_u32(static_cast<unsigned char>(carry), lhs, rhs, &sum);
+                        return static_cast<digit_t>(sum);
+                    }
+#elif defined(ECG_HAS_ADDC_BUILTINS)
+                    if constexpr (sizeof(digit_t) == sizeof(unsigned long long)) {
+                        unsigned long long carry_out = 0;
+                        const digit_t sum = __builtin_addcll(lhs, rhs, carry, &carry_out);
+                        carry = static_cast<digit_t>(carry_out);
+                        return sum;
+                    } else {
+                        unsigned int carry_out = 0;
+                        const digit_t sum = __builtin_addc(lhs, rhs, carry, &carry_out);
+                        carry = static_cast<digit_t>(carry_out);
+                        return sum;
+                    }
+#endif
+                }
+
+                digit_t sum = lhs + rhs;
+                digit_t overflow = static_cast<digit_t>(sum < lhs);
+                sum += carry;
+                overflow |= static_cast<digit_t>(sum < carry);
+                carry = overflow;
+                return sum;
+            }
+
+            // Returns lhs - rhs - borrow, borrow becomes the outgoing borrow
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr digit_t sub(digit_t lhs, digit_t rhs, digit_t& borrow) {
+                if (!std::is_constant_evaluated()) {
+#if defined(ECG_HAS_ADDCARRY_INTRINSICS)
+                    if constexpr (sizeof(digit_t) == sizeof(unsigned long long)) {
+                        unsigned long long difference = 0;
+                        borrow = _subborrow_u64(static_cast<unsigned char>(borrow), lhs, rhs, &difference);
+                        return static_cast<digit_t>(difference);
+                    } else {
+                        unsigned int difference = 0;
+                        borrow = _subborrow_u32(static_cast<unsigned char>(borrow), lhs, rhs, &difference);
+                        return static_cast<digit_t>(difference);
+                    }
+#elif defined(ECG_HAS_ADDC_BUILTINS)
+                    if constexpr (sizeof(digit_t) == sizeof(unsigned long long)) {
+                        unsigned long long borrow_out = 0;
+                        const digit_t difference = __builtin_subcll(lhs, rhs, borrow, &borrow_out);
+                        borrow = static_cast<digit_t>(borrow_out);
+                        return difference;
+                    } else {
+                        unsigned int borrow_out = 0;
+                        const digit_t difference = __builtin_subc(lhs, rhs, borrow, &borrow_out);
+                        borrow = static_cast<digit_t>(borrow_out);
+                        return difference;
+                    }
+#endif
+                }
+
+                digit_t difference = lhs - rhs;
+                digit_t underflow = static_cast<digit_t>(difference > lhs);
+                underflow |= static_cast<digit_t>(difference < borrow);
+                difference -= borrow;
+                borrow = underflow;
+                return difference;
+            }
+
+            // Returns low digit of lhs * rhs, high digit is written into high
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr digit_t mul(digit_t lhs, digit_t rhs, digit_t& high) {
+                if constexpr (c_has_double_digit<digit_t>) {
+                    using wide_t = double_digit_t<digit_t>;
+                    wide_t product = static_cast<wide_t>(lhs) * static_cast<wide_t>(rhs);
+                    high = static_cast<digit_t>(product >> c_digit_size<digit_t>);
+                    return static_cast<digit_t>(product);
+                } else {
+#ifdef ECG_HAS_UMUL128_INTRINSICS
+                    if (!std::is_constant_evaluated()) {
+                        unsigned long long product_high = 0;
+                        const digit_t low = _umul128(lhs, rhs, &product_high);
+                        high = static_cast<digit_t>(product_high);
+                        return low;
+                    }
+#endif
+                    constexpr size_t c_half_size = c_digit_size<digit_t> / 2;
+                    constexpr digit_t c_half_mask = (static_cast<digit_t>(1) << c_half_size) - 1;
+
+                    const digit_t lhs_low = lhs & c_half_mask;
+                    const digit_t lhs_high = lhs >> c_half_size;
+                    const digit_t rhs_low = rhs & c_half_mask;
+                    const digit_t rhs_high = rhs >> c_half_size;
+
+                    const digit_t low_low = lhs_low * rhs_low;
+                    const digit_t low_high = lhs_low * rhs_high;
+                    const digit_t high_low = lhs_high * rhs_low;
+                    const digit_t high_high = lhs_high * rhs_high;
+
+                    const digit_t middle =
+                        (low_low >> c_half_size) + (low_high & c_half_mask) + (high_low & c_half_mask);
+                    high = high_high + (low_high >> c_half_size) + (high_low >> c_half_size)
+                         + (middle >> c_half_size);
+                    return (middle << c_half_size) | (low_low & c_half_mask);
+                }
+            }
+
+            // Returns low digit of lhs * rhs + addend + carry, carry becomes the high digit.
+            // Never overflows: (b - 1)^2 + 2(b - 1) = b^2 - 1
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr digit_t mul_add(digit_t lhs, digit_t rhs, digit_t addend, digit_t& carry) {
+                if constexpr (c_has_double_digit<digit_t>) {
+                    using wide_t = double_digit_t<digit_t>;
+                    wide_t result = static_cast<wide_t>(lhs) * static_cast<wide_t>(rhs)
+                                  + static_cast<wide_t>(addend) + static_cast<wide_t>(carry);
+                    carry = static_cast<digit_t>(result >> c_digit_size<digit_t>);
+                    return static_cast<digit_t>(result);
+                } else {
+                    digit_t high = 0;
+                    digit_t low = mul(lhs, rhs, high);
+                    low += addend;
+                    high += static_cast<digit_t>(low < addend);
+                    low += carry;
+                    high += static_cast<digit_t>(low < carry);
+                    carry = high;
+                    return low;
+                }
+            }
+
+            // Adds lhs * rhs into the three-digit accumulator (low, middle, high). With a double digit the
+            // two-digit addition is left to the compiler, which keeps it in one add/adc pair
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr void mul_accumulate(digit_t lhs, digit_t rhs, digit_t& low, digit_t& middle,
+                                          digit_t& high) {
+                if constexpr (c_has_double_digit<digit_t>) {
+                    using wide_t = double_digit_t<digit_t>;
+                    const wide_t product = static_cast<wide_t>(lhs) * static_cast<wide_t>(rhs);
+                    const wide_t accumulator = (static_cast<wide_t>(middle) << c_digit_size<digit_t>) | low;
+                    const wide_t sum = accumulator + product;
+                    high += static_cast<digit_t>(sum < product);
+                    middle = static_cast<digit_t>(sum >> c_digit_size<digit_t>);
+                    low = static_cast<digit_t>(sum);
+                } else {
+                    digit_t product_high = 0;
+                    const digit_t product_low = mul(lhs, rhs, product_high);
+                    digit_t carry = 0;
+                    low = add(low, product_low, carry);
+                    middle = add(middle, product_high, carry);
+                    high += carry;
+                }
+            }
+
+            // Returns (high * b + low) / divisor, the remainder goes into remainder. Requires high < divisor
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr digit_t div(digit_t high, digit_t low, digit_t divisor, digit_t& remainder) {
+                if constexpr (c_has_double_digit<digit_t>) {
+                    using wide_t = double_digit_t<digit_t>;
+                    wide_t dividend = (static_cast<wide_t>(high) << c_digit_size<digit_t>) | low;
+                    remainder = static_cast<digit_t>(dividend % divisor);
+                    return static_cast<digit_t>(dividend / divisor);
+                } else {
+#ifdef ECG_HAS_UMUL128_INTRINSICS
+                    if (!std::is_constant_evaluated()) {
+                        unsigned long long quotient_remainder = 0;
+                        const digit_t quotient = _udiv128(high, low, divisor, &quotient_remainder);
+                        remainder = static_cast<digit_t>(quotient_remainder);
+                        return quotient;
+                    }
+#endif
+                    // Hacker's Delight, divlu: two half-digit steps of Knuth's algorithm D
+                    constexpr size_t c_half_size = c_digit_size<digit_t> / 2;
+                    constexpr digit_t c_half_base = static_cast<digit_t>(1) << c_half_size;
+                    constexpr digit_t c_half_mask = c_half_base - 1;
+
+                    const size_t shift = static_cast<size_t>(std::countl_zero(divisor));
+                    divisor <<= shift;
+                    const digit_t divisor_high = divisor >> c_half_size;
+                    const digit_t divisor_low = divisor & c_half_mask;
+
+                    const digit_t dividend_high =
+                        (high << shift) | (shift == 0 ? 0 : low >> (c_digit_size<digit_t> - shift));
+                    const digit_t dividend_low = low << shift;
+                    const digit_t dividend_1 = dividend_low >> c_half_size;
+                    const digit_t dividend_0 = dividend_low & c_half_mask;
+
+                    digit_t quotient_1 = dividend_high / divisor_high;
+                    digit_t rest = dividend_high - quotient_1 * divisor_high;
+
+                    while (quotient_1 >= c_half_base
+                           || quotient_1 * divisor_low > ((rest << c_half_size) | dividend_1)) {
+                        --quotient_1;
+                        rest += divisor_high;
+
+                        if (rest >= c_half_base) {
+                            break;
+                        }
+                    }
+
+                    const digit_t dividend_21 =
+                        (dividend_high << c_half_size) + dividend_1 - quotient_1 * divisor;
+                    digit_t quotient_0 = dividend_21 / divisor_high;
+                    rest = dividend_21 - quotient_0 * divisor_high;
+
+                    while (quotient_0 >= c_half_base
+                           || quotient_0 * divisor_low > ((rest << c_half_size) | dividend_0)) {
+                        --quotient_0;
+                        rest += divisor_high;
+
+                        if (rest >= c_half_base) {
+                            break;
+                        }
+                    }
+
+                    remainder = ((dividend_21 << c_half_size) + dividend_0 - quotient_0 * divisor) >> shift;
+                    return (quotient_1 << c_half_size) | quotient_0;
+                }
+            }
+
+            // Möller, Granlund, "Improved division by invariant integers", 2011. A normalized divisor (top
+            // bit set) gets a reciprocal once, after that every quotient digit costs two multiplications and
+            // no division instruction
+
+            // Returns floor((b^2 - 1) / divisor) - b, divisor must be normalized
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr digit_t reciprocal_2by1(digit_t divisor) {
+                digit_t remainder = 0;
+                constexpr digit_t c_max_digit = std::numeric_limits<digit_t>::max();
+                return div(static_cast<digit_t>(c_max_digit - divisor), c_max_digit, divisor, remainder);
+            }
+
+            // Returns floor((b^3 - 1) / (high * b + low)) - b, high must be normalized
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr digit_t reciprocal_3by2(digit_t high, digit_t low) {
+                digit_t result = reciprocal_2by1(high);
+                digit_t product_high = 0;
+                digit_t product = high * result;
+                product += low;
+
+                if (product < low) {
+                    --result;
+
+                    if (product >= high) {
+                        --result;
+                        product -= high;
+                    }
+
+                    product -= high;
+                }
+
+                const digit_t product_low = mul(result, low, product_high);
+                product += product_high;
+
+                if (product < product_high) {
+                    --result;
+
+                    if (product > high || (product == high && product_low >= low)) {
+                        --result;
+                    }
+                }
+
+                return result;
+            }
+
+            // Returns (high * b + low) / divisor with the reciprocal_2by1 of divisor. Requires high < divisor
+            // and a normalized divisor
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr digit_t div_2by1(digit_t high, digit_t low, digit_t divisor, digit_t reciprocal,
+                                       digit_t& remainder) {
+                digit_t quotient_high = 0;
+                digit_t quotient_low = mul(high, reciprocal, quotient_high);
+                digit_t carry = 0;
+                quotient_low = add(quotient_low, low, carry);
+                quotient_high = quotient_high + high + 1 + carry;
+
+                remainder = low - quotient_high * divisor;
+
+                if (remainder > quotient_low) {
+                    --quotient_high;
+                    remainder += divisor;
+                }
+
+                if (remainder >= divisor) {
+                    ++quotient_high;
+                    remainder -= divisor;
+                }
+
+                return quotient_high;
+            }
+
+            // Returns (top * b^2 + high * b + low) / (divisor_high * b + divisor_low) with the
+            // reciprocal_3by2 of the divisor, the two-digit remainder goes into remainder_high and
+            // remainder_low. Requires (top, high) < (divisor_high, divisor_low) and a normalized divisor_high
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr digit_t div_3by2(digit_t top, digit_t high, digit_t low, digit_t divisor_high,
+                                       digit_t divisor_low, digit_t reciprocal, digit_t& remainder_high,
+                                       digit_t& remainder_low) {
+                digit_t quotient = 0;
+                digit_t quotient_low = mul(top, reciprocal, quotient);
+                digit_t carry = 0;
+                quotient_low = add(quotient_low, high, carry);
+                quotient = quotient + top + carry;
+
+                // Two lowest digits of (top, high, low) - quotient * divisor - divisor
+                remainder_high = high - divisor_high * quotient;
+                digit_t borrow = 0;
+                remainder_low = sub(low, divisor_low, borrow);
+                remainder_high = sub(remainder_high, divisor_high, borrow);
+
+                digit_t product_high = 0;
+                const digit_t product_low = mul(divisor_low, quotient, product_high);
+                borrow = 0;
+                remainder_low = sub(remainder_low, product_low, borrow);
+                remainder_high = sub(remainder_high, product_high, borrow);
+                ++quotient;
+
+                if (remainder_high >= quotient_low) {
+                    --quotient;
+                    carry = 0;
+                    remainder_low = add(remainder_low, divisor_low, carry);
+                    remainder_high = add(remainder_high, divisor_high, carry);
+                }
+
+                if (remainder_high > divisor_high
+                    || (remainder_high == divisor_high && remainder_low >= divisor_low)) {
+                    ++quotient;
+                    borrow = 0;
+                    remainder_low = sub(remainder_low, divisor_low, borrow);
+                    remainder_high = sub(remainder_high, divisor_high, borrow);
+                }
+
+                return quotient;
+            }
+        }   // namespace digit
+    }       // namespace algorithm
+}   // namespace elliptic_curve_guide
+#endif
@@ -0,0 +1,160 @@
+#include "fast-pow.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+
+namespace elliptic_curve_guide::algorithm {
+    PowerPlan::PowerPlan(const wide_uint& power) : m_power(power) {
+        if (power == 0) {
+            return;
+        }
+
+        size_t best_cost = std::numeric_limits<size_t>::max();
+
+        for (size_t width = 1; width <= 5; ++width) {
+            Steps table;
+            Steps steps;
+            sliding_window(power, width, table, steps);
+
+            if (cost(table, steps) < best_cost) {
+                best_cost = cost(table, steps);
+                m_table = std::move(table);
+                m_steps = std::move(steps);
+            }
+        }
+
+        for (size_t max_log_length = 1; max_log_length < c_max_table_size; ++max_log_length) {
+            Steps table;
+            Steps steps;
+            runs_of_ones(power, max_log_length, table, steps);
+
+            if (cost(table, steps) < best_cost) {
+                best_cost = cost(table, steps);
+                m_table = std::move(table);
+                m_steps = std::move(steps);
+            }
+        }
+
+        assert(m_table.size() < c_max_table_size && "PowerPlan::PowerPlan : table is too large");
+    }
+
+    const wide_uint& PowerPlan::power() const {
+        return m_power;
+    }
+
+    size_t PowerPlan::cost() const {
+        return cost(m_table, m_steps);
+    }
+
+    size_t PowerPlan::cost(const Steps& table, const Steps& steps) {
+        const auto step_cost = [](const Step& step) {
+            return step.squarings + (step.factor != c_no_factor ? 1 : 0);
+        };
+
+        size_t result = 0;
+
+        for (const Step& step : table) {
+            result += step_cost(step);
+        }
+
+        for (size_t i = 1; i < steps.size(); ++i) {
+            result += step_cost(steps[i]);
+        }
+
+        return result;
+    }
+
+    // Windows of at most width bits that start and end with a one, the odd power 2j + 1 is the entry j + 1
+    // and x^2 is the entry 1 for j > 0, the base itself for j = 0
+    void PowerPlan::sliding_window(const wide_uint& power, size_t width, Steps& table, Steps& steps) {
+        const size_t odd_powers_number = static_cast<size_t>(1) << (width - 1);
+        const auto index = [](size_t odd_power) { return odd_power == 1 ? 0 : odd_power / 2 + 1; };
+
+        if (odd_powers_number > 1) {
+            table.push_back({.squarings = 1, .factor = c_no_factor, .source = 0});
+
+            for (size_t odd_power = 3; odd_power < 2 * odd_powers_number; odd_power += 2) {
+                table.push_back({.squarings = 0, .factor = 1, .source = index(odd_power - 2)});
+            }
+        }
+
+        size_t squarings = 0;
+
+        for (size_t i = actual_bit_size(power); i > 0;) {
+            if (!test_bit(power, i - 1)) {
+                ++squarings;
+                --i;
+                continue;
+            }
+
+            size_t low = i > width ? i - width : 0;
+
+            while (!test_bit(power, low)) {
+                ++low;
+            }
+
+            const size_t length = i - low;
+            const size_t odd_power = extract_bits(power, low, length);
+            const size_t step_squarings = steps.empty() ? 0 : squarings + length;
+            steps.push_back({.squarings = step_squarings, .factor = index(odd_power)});
+            squarings = 0;
+            i = low;
+        }
+
+        if (squarings > 0) {
+            steps.push_back({.squarings = squarings, .factor = c_no_factor});
+        }
+    }
+
+    // The entry k is x^(2^(2^k) - 1), x^(2^(2l) - 1) = (x^(2^l - 1))^(2^l) * x^(2^l - 1). A run of ones is
+    // split into the longest such blocks
+    void PowerPlan::runs_of_ones(const wide_uint& power, size_t max_log_length, Steps& table,
+                                 Steps& steps) {
+        for (size_t k = 1; k <= max_log_length; ++k) {
+            const size_t half_length = static_cast<size_t>(1) << (k - 1);
+            table.push_back({.squarings = half_length, .factor = k - 1, .source = k - 1});
+        }
+
+        size_t squarings = 0;
+
+        for (size_t i = actual_bit_size(power); i > 0;) {
+            if (!test_bit(power, i - 1)) {
+                ++squarings;
+                --i;
+                continue;
+            }
+
+            size_t length = 0;
+
+            while (length < i && test_bit(power, i - 1 - length)) {
+                ++length;
+            }
+
+            i -= length;
+
+            while (length > 0) {
+                const size_t k = std::min(max_log_length, static_cast<size_t>(std::bit_width(length)) - 1);
+                const size_t block = static_cast<size_t>(1) << k;
+                steps.push_back({.squarings = steps.empty() ? 0 : squarings + block, .factor = k});
+                squarings = 0;
+                length -= block;
+            }
+        }
+
+        if (squarings > 0) {
+            steps.push_back({.squarings = squarings, .factor = c_no_factor});
+        }
+
+        // Entries past the longest block are never used
+        size_t used = 0;
+
+        for (const Step& step : steps) {
+            if (step.factor != c_no_factor) {
+                used = std::max(used, step.factor);
+            }
+        }
+
+        table.resize(used);
+    }
+}   // namespace elliptic_curve_guide::algorithm
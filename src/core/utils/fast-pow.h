@@ -1,23 +1,105 @@
 #ifndef ECG_FAST_POW_H
 #define ECG_FAST_POW_H
 
+#include "bitsize.h"
 #include "uint.h"
 
+#include <array>
+#include <cassert>
+#include <limits>
+#include <vector>
+
 namespace elliptic_curve_guide {
     namespace algorithm {
-        template<typename T>
-        T fast_pow(const T& value, const uint& power) {
-            if ((power & 1) != 0) {
-                if (power == 1) {
-                    return value;
+        // Left-to-right binary exponentiation, power must not be zero
+        template<typename T, typename Power = uint>
+        T fast_pow(const T& value, const Power& power) {
+            T result = value;
+
+            for (size_t i = actual_bit_size(power) - 1; i > 0; --i) {
+                if constexpr (requires { T::square(result); }) {
+                    result = T::square(result);
+                } else {
+                    result = result * result;
                 }
 
-                return value * fast_pow<T>(value, power - 1);
+                if (test_bit(power, i - 1)) {
+                    result = result * value;
+                }
             }
 
-            T temp = fast_pow<T>(value, power >> 1);
-            return temp * temp;
+            return result;
         }
+
+        // Exponentiation by a fixed power, prepared once and run for many bases. A table of powers of the
+        // base is built first, then every step squares the accumulator a few times and multiplies it by a
+        // table entry. The table holds either the odd powers of a sliding window, or x^(2^k - 1) for runs
+        // of ones, which turns exponents such as p - 2 and (p + 1) / 4 of the NIST and secp primes into the
+        // usual hand-written addition chains. The cheaper of the two is chosen. The power is kept in a
+        // wide_uint, which holds the powers of every field width
+        class PowerPlan {
+        public:
+            static constexpr size_t c_max_table_size = 17;
+
+            PowerPlan() = default;
+            explicit PowerPlan(const wide_uint& power);
+
+            const wide_uint& power() const;
+
+            // Number of squarings and multiplications of one run
+            size_t cost() const;
+
+            // Returns value^power, multiply and square are the operations of T. The power must not be zero
+            template<typename T, typename Multiply, typename Square>
+            T run(const T& value, Multiply multiply, Square square) const {
+                assert(!m_steps.empty() && "PowerPlan::run : power must not be zero");
+                std::array<T, c_max_table_size> table;
+                table[0] = value;
+
+                for (size_t i = 0; i < m_table.size(); ++i) {
+                    table[i + 1] = apply(table[m_table[i].source], m_table[i], table, multiply, square);
+                }
+
+                T result = table[m_steps.front().factor];
+
+                for (size_t i = 1; i < m_steps.size(); ++i) {
+                    result = apply(result, m_steps[i], table, multiply, square);
+                }
+
+                return result;
+            }
+
+        private:
+            static constexpr size_t c_no_factor = std::numeric_limits<size_t>::max();
+
+            // value^(2^squarings) * table[factor], table entries also name the entry they start from
+            struct Step {
+                size_t squarings = 0;
+                size_t factor = c_no_factor;
+                size_t source = 0;
+            };
+
+            using Steps = std::vector<Step>;
+
+            template<typename T, typename Multiply, typename Square>
+            static T apply(T value, const Step& step, const std::array<T, c_max_table_size>& table,
+                           Multiply& multiply, Square& square) {
+                for (size_t i = 0; i < step.squarings; ++i) {
+                    value = square(value);
+                }
+
+                return step.factor == c_no_factor ? value : multiply(value, table[step.factor]);
+            }
+
+            static size_t cost(const Steps& table, const Steps& steps);
+            static void sliding_window(const wide_uint& power, size_t width, Steps& table, Steps& steps);
+            static void runs_of_ones(const wide_uint& power, size_t max_log_length, Steps& table,
+                                     Steps& steps);
+
+            wide_uint m_power = 0;
+            Steps m_table;   // m_table[i] is the table entry i + 1, the entry 0 is the base
+            Steps m_steps;   // the first step only picks the starting table entry
+        };
     }   // namespace algorithm
 }   // namespace elliptic_curve_guide
 #endif
@@ -1,14 +1,273 @@
 #ifndef ECG_FIELD_ROOT_H
 #define ECG_FIELD_ROOT_H
 
+#include "bitsize.h"
+#include "fast-pow.h"
 #include "field.h"
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <limits>
 #include <optional>
+#include <vector>
 
 namespace elliptic_curve_guide {
     namespace algorithm {
-        std::optional<field::FieldElement> find_root(const field::FieldElement& value,
-                                                     const field::Field& field);
+        // Square roots in one field, prepared once by the sqrt_context of the field. The method is chosen by
+        // p mod 8: a single exponentiation for p = 3 mod 4, Atkin's method for p = 5 mod 8 and Tonelli-Shanks
+        // with Bernstein's tables for p = 1 mod 8. A root is found without allocations
+        template<typename Field>
+        class BasicSqrtContext {
+            using Element = typename Field::Element;
+
+        public:
+            static constexpr size_t c_max_windows = 128;
+
+            explicit BasicSqrtContext(const Field& field);
+
+            // Returns a square root of value, or nothing if value is zero or a quadratic nonresidue
+            std::optional<Element> find_root(const Element& value) const;
+
+        private:
+            static constexpr size_t c_max_window = 8;
+            static constexpr size_t c_max_table_size = 4096;
+
+            enum class Method {
+                Trivial,
+                ThreeModFour,
+                FiveModEight,
+                TonelliShanks,
+            };
+
+            static Element find_nonresidue(const Element& one);
+
+            std::optional<Element> tonelli_shanks(const Element& value) const;
+            const Element& inverse_power(size_t shift, size_t digit) const;
+
+            Method m_method = Method::Trivial;
+            PowerPlan m_plan;   // (p + 1) / 4, (p - 5) / 8 or (q - 1) / 2, where p - 1 = 2^e * q
+
+            // The discrete logarithm of a^q to the base g = b^q, b is a quadratic nonresidue, is found by
+            // windows of m_window bits, the top one holds the rest of the e bits
+            size_t m_power_of_two = 0;
+            size_t m_window = 0;
+            size_t m_windows = 0;
+            std::vector<Element> m_lookup;           // g^(d * 2^(e - m_window))
+            std::vector<Element> m_inverse_powers;   // g^(-d * 2^s) at s * 2^m_window + d
+        };
+
+        using SqrtContext = BasicSqrtContext<field::Field>;
+
+        template<typename Field>
+        typename Field::Element BasicSqrtContext<Field>::find_nonresidue(const Element& one) {
+            Element b = one + one;
+
+            while (b.jacobi_symbol() != -1) {
+                b += one;
+            }
+
+            return b;
+        }
+
+        template<typename Field>
+        BasicSqrtContext<Field>::BasicSqrtContext(const Field& field) {
+            using uint_type = typename Field::uint_type;
+            const uint_type& p = field.modulus();
+
+            if ((p & 0b11) == 3) {
+                m_method = Method::ThreeModFour;
+                m_plan = PowerPlan((p + 1) >> 2);
+                return;
+            }
+
+            if ((p & 0b111) == 5) {
+                m_method = Method::FiveModEight;
+                m_plan = PowerPlan((p - 5) >> 3);
+                return;
+            }
+
+            if ((p & 1) == 0) {
+                m_method = Method::Trivial;
+                return;
+            }
+
+            m_method = Method::TonelliShanks;
+            const size_t e = count_trailing_zeros(p - 1);
+            const uint_type residue = (p - 1) >> e;
+            m_power_of_two = e;
+            m_plan = PowerPlan((residue - 1) >> 1);
+
+            // A window costs a lookup among 2^width elements and a multiplication by every lower window. The
+            // tables grow as e * 2^width, so the width stops at the first one with a too large table
+            size_t best_cost = std::numeric_limits<size_t>::max();
+
+            for (size_t width = 1; width <= std::min(e, c_max_window); ++width) {
+                const size_t windows = (e + width - 1) / width;
+
+                if (windows > c_max_windows) {
+                    continue;
+                }
+
+                if (m_window != 0 && (e << width) > c_max_table_size) {
+                    break;
+                }
+
+                const size_t lookups = windows * (static_cast<size_t>(1) << width) / 16;
+                const size_t cost = windows * (windows - 1) / 2 + lookups;
+
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    m_window = width;
+                    m_windows = windows;
+                }
+            }
+
+            const Element g = Element::pow(find_nonresidue(field.element(1)), residue);
+            const size_t table_size = static_cast<size_t>(1) << m_window;
+
+            Element h = g;
+
+            for (size_t i = m_window; i < e; ++i) {
+                h = Element::square(h);
+            }
+
+            m_lookup.reserve(table_size);
+            m_lookup.push_back(field.element(1));
+
+            for (size_t d = 1; d < table_size; ++d) {
+                m_lookup.push_back(m_lookup.back() * h);
+            }
+
+            Element base = Element::inverse(g);
+            m_inverse_powers.reserve(e * table_size);
+
+            for (size_t s = 0; s < e; ++s) {
+                m_inverse_powers.push_back(field.element(1));
+
+                for (size_t d = 1; d < table_size; ++d) {
+                    m_inverse_powers.push_back(m_inverse_powers.back() * base);
+                }
+
+                base = Element::square(base);
+            }
+        }
+
+        template<typename Field>
+        std::optional<typename Field::Element>
+            BasicSqrtContext<Field>::find_root(const Element& value) const {
+            // The Jacobi symbol is several times cheaper than an exponentiation, so nonresidues are rejected
+            // before any of the methods
+            if (!value.is_invertible() || value.jacobi_symbol() != 1) {
+                return std::nullopt;
+            }
+
+            switch (m_method) {
+                case Method::Trivial:
+                    return value;
+                case Method::ThreeModFour:
+                    return Element::pow(value, m_plan);
+                case Method::FiveModEight: {
+                    // b = (2a)^((p - 5) / 8), i = 2ab^2 is a square root of -1 and ab(i - 1) is a square root
+                    // of a
+                    const Element twice = value + value;
+                    const Element b = Element::pow(twice, m_plan);
+                    const Element ab = value * b;
+                    const Element i = twice * Element::square(b);
+                    return ab * i - ab;
+                }
+                case Method::TonelliShanks:
+                    return tonelli_shanks(value);
+            }
+
+            return std::nullopt;
+        }
+
+        template<typename Field>
+        const typename Field::Element& BasicSqrtContext<Field>::inverse_power(size_t shift,
+                                                                             size_t digit) const {
+            return m_inverse_powers[(shift << m_window) + digit];
+        }
+
+        // With x = a^((q + 1) / 2) and t = a^q = g^k, x * g^(-k / 2) is a square root of a residue a, for
+        // which k is even. The digit k_j of k is the window of t^(2^(e - c_j)), c_j is the top of the
+        // window, once the lower digits are taken out of it by the tables: the powers of t take e squarings
+        // in total and the lower digits m(m - 1) / 2 multiplications for m windows
+        template<typename Field>
+        std::optional<typename Field::Element>
+            BasicSqrtContext<Field>::tonelli_shanks(const Element& value) const {
+            const size_t e = m_power_of_two;
+            const size_t w = m_window;
+            const size_t n = m_windows;
+            const size_t top_window = e - (n - 1) * w;
+
+            const Element u = Element::pow(value, m_plan);
+            Element root = value * u;
+
+            std::array<std::optional<Element>, c_max_windows> powers;
+            powers[n - 1].emplace(root * u);
+
+            for (size_t j = n - 1; j > 0; --j) {
+                Element power = *powers[j];
+
+                for (size_t i = 0; i < (j + 1 == n ? top_window : w); ++i) {
+                    power = Element::square(power);
+                }
+
+                powers[j - 1].emplace(std::move(power));
+            }
+
+            std::array<size_t, c_max_windows> digits = {};
+
+            for (size_t j = 0; j < n; ++j) {
+                const size_t width = j + 1 == n ? top_window : w;
+                const size_t top = j * w + width;
+                Element& power = *powers[j];
+
+                for (size_t i = 0; i < j; ++i) {
+                    if (digits[i] != 0) {
+                        power *= inverse_power(i * w + e - top, digits[i]);
+                    }
+                }
+
+                // power = g^(k_j * 2^(e - width)) is found among the powers of g^(2^(e - w))
+                const size_t stride = static_cast<size_t>(1) << (w - width);
+                size_t digit = 0;
+
+                while (digit < (static_cast<size_t>(1) << width) && m_lookup[digit * stride] != power) {
+                    ++digit;
+                }
+
+                assert(digit < (static_cast<size_t>(1) << width)
+                       && "BasicSqrtContext::tonelli_shanks : a^q is not a power of g");
+                digits[j] = digit;
+            }
+
+            assert((digits[0] & 1) == 0
+                   && "BasicSqrtContext::tonelli_shanks : value must be a quadratic residue");
+            root *= inverse_power(0, digits[0] >> 1);
+
+            for (size_t i = 1; i < n; ++i) {
+                if (digits[i] != 0) {
+                    root *= inverse_power(i * w - 1, digits[i]);
+                }
+            }
+
+            return root;
+        }
+
+        template<typename Field>
+        std::optional<typename Field::Element> find_root(const typename Field::Element& value,
+                                                         const Field& field) {
+            return field.sqrt_context().find_root(value);
+        }
+
+        extern template class BasicSqrtContext<field::Field>;
+#ifndef ECG_USE_BOOST
+        extern template class BasicSqrtContext<field::BasicField<uint256>>;
+        extern template class BasicSqrtContext<field::BasicField<uint384>>;
+        extern template class BasicSqrtContext<field::BasicField<uint576>>;
+#endif
     }   // namespace algorithm
 }   // namespace elliptic_curve_guide
 #endif
@@ -0,0 +1,53 @@
+#ifndef ECG_JACOBI_SYMBOL_H
+#define ECG_JACOBI_SYMBOL_H
+
+#include "uint.h"
+
+#include <cassert>
+#include <utility>
+
+namespace elliptic_curve_guide {
+    namespace algorithm {
+        // Binary algorithm for types without their own kernel: a is made odd by shifts, a shift by one flips
+        // the sign if b = 3, 5 mod 8. The smaller odd value is then subtracted from the larger, and swapping
+        // them flips the sign if both are 3 mod 4. The modulus must be odd, value must be less than modulus
+        template<typename T>
+        int binary_jacobi(const T& value, const T& modulus) {
+            T a = value;
+            T b = modulus;
+            int result = 1;
+
+            while (a != 0) {
+                while ((a & 1) == 0) {
+                    a >>= 1;
+
+                    if ((b & 7) == 3 || (b & 7) == 5) {
+                        result = -result;
+                    }
+                }
+
+                if (a < b) {
+                    std::swap(a, b);
+
+                    if ((a & 3) == 3 && (b & 3) == 3) {
+                        result = -result;
+                    }
+                }
+
+                a -= b;
+            }
+
+            return b == 1 ? result : 0;
+        }
+
+        // Returns the Jacobi symbol (value / modulus) for an odd modulus, which is the Legendre symbol for a
+        // prime one: 1 for quadratic residues, -1 for non-residues and 0 for multiples of modulus. uint_t
+        // has its own kernel for it
+        template<typename T>
+        int jacobi_symbol(const T& value, const T& modulus) {
+            assert((modulus & 1) != 0 && "jacobi_symbol : modulus must be odd");
+            return binary_jacobi(value < modulus ? value : T(value % modulus), modulus);
+        }
+    }   // namespace algorithm
+}   // namespace elliptic_curve_guide
+#endif
@@ -0,0 +1,64 @@
+#include "lanes.h"
+
+#if defined(ECG_HAS_X86_LANES) && defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+namespace elliptic_curve_guide::algorithm::lanes {
+#ifdef ECG_HAS_X86_LANES
+    // The processor must have the instructions and the operating system must save their registers
+    static Extension detect_extension() {
+    #ifdef _MSC_VER
+        int info[4];
+        __cpuid(info, 0);
+
+        if (info[0] < 7) {
+            return Extension::None;
+        }
+
+        __cpuid(info, 1);
+        const bool has_xsave = (info[2] >> 27 & 1) != 0;
+        const bool has_avx = (info[2] >> 28 & 1) != 0;
+
+        if (!has_xsave || !has_avx) {
+            return Extension::None;
+        }
+
+        // The states of SSE and AVX, then of the mask registers and of the upper halves of the 512-bit ones
+        const unsigned long long saved = _xgetbv(0);
+        __cpuidex(info, 7, 0);
+
+        if ((info[1] >> 16 & 1) != 0 && (saved & 0xe6) == 0xe6) {
+            return Extension::Avx512;
+        }
+
+        if ((info[1] >> 5 & 1) != 0 && (saved & 0x6) == 0x6) {
+            return Extension::Avx2;
+        }
+
+        return Extension::None;
+    #else
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx512f")) {
+            return Extension::Avx512;
+        }
+
+        if (__builtin_cpu_supports("avx2")) {
+            return Extension::Avx2;
+        }
+
+        return Extension::None;
+    #endif
+    }
+#endif
+
+    Extension supported_extension() {
+#ifdef ECG_HAS_X86_LANES
+        static const Extension result = detect_extension();
+        return result;
+#else
+        return Extension::None;
+#endif
+    }
+}   // namespace elliptic_curve_guide::algorithm::lanes
@@ -0,0 +1,608 @@
+#ifndef ECG_LANES_H
+#define ECG_LANES_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+// The vector kernels are compiled on every x86-64 target and chosen at run time by the processor. MSVC takes
+// AVX2 and AVX-512 intrinsics without /arch, gcc and clang take them in functions with a target attribute
+#if defined(_M_X64) || defined(__x86_64__)
+    #include <immintrin.h>
+    #define ECG_HAS_X86_LANES
+#endif
+
+#if defined(__GNUC__)
+    #define ECG_TARGET_AVX2 __attribute__((target("avx2")))
+    #define ECG_TARGET_AVX512 __attribute__((target("avx512f")))
+    #define ECG_FORCE_INLINE __attribute__((always_inline)) inline
+#else
+    #define ECG_TARGET_AVX2
+    #define ECG_TARGET_AVX512
+    #define ECG_FORCE_INLINE __forceinline
+#endif
+
+namespace elliptic_curve_guide {
+    namespace algorithm {
+        namespace lanes {
+            // Element-wise arithmetic on many values at once. A value is split into 32-bit limbs, and a lane
+            // holds one limb of one value in 64 bits, so the product of two limbs plus two more limbs never
+            // overflows the lane. A set of lanes is c_lanes consecutive values of an array of limbs.
+            // Vectors are passed by reference only, since their ABI differs between the extensions, and
+            // every operation reads its operands before it writes result, so result may be one of them
+            struct ScalarLanes {
+                using type = uint64_t;
+                static constexpr size_t c_lanes = 1;
+
+                static void load(type& result, const uint32_t* limbs) {
+                    result = *limbs;
+                }
+
+                static void store(uint32_t* limbs, const type& value) {
+                    *limbs = static_cast<uint32_t>(value);
+                }
+
+                static void broadcast(type& result, uint64_t value) {
+                    result = value;
+                }
+
+                static void add(type& result, const type& lhs, const type& rhs) {
+                    result = lhs + rhs;
+                }
+
+                static void sub(type& result, const type& lhs, const type& rhs) {
+                    result = lhs - rhs;
+                }
+
+                // The product of the low halves
+                static void mul(type& result, const type& lhs, const type& rhs) {
+                    result = (lhs & 0xffffffff) * (rhs & 0xffffffff);
+                }
+
+                static void low(type& result, const type& value) {
+                    result = value & 0xffffffff;
+                }
+
+                static void high(type& result, const type& value) {
+                    result = value >> 32;
+                }
+
+                // All ones where the lane is negative as a signed number, zero elsewhere
+                static void negative(type& result, const type& value) {
+                    result = type(0) - (value >> 63);
+                }
+
+                static void is_zero(type& result, const type& value) {
+                    result = value == 0 ? ~type(0) : type(0);
+                }
+
+                static void bit_or(type& result, const type& lhs, const type& rhs) {
+                    result = lhs | rhs;
+                }
+
+                // lhs where mask is all ones, rhs where it is zero
+                static void select(type& result, const type& mask, const type& lhs, const type& rhs) {
+                    result = (lhs & mask) | (rhs & ~mask);
+                }
+            };
+
+#ifdef ECG_HAS_X86_LANES
+            struct Avx2Lanes {
+                using type = __m256i;
+                static constexpr size_t c_lanes = 4;
+
+                ECG_TARGET_AVX2 static void load(type& result, const uint32_t* limbs) {
+                    result = _mm256_cvtepu32_epi64(_mm_load_si128(reinterpret_cast<const __m128i*>(limbs)));
+                }
+
+                ECG_TARGET_AVX2 static void store(uint32_t* limbs, const type& value) {
+                    const __m256i low_halves = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+                    const __m256i packed = _mm256_permutevar8x32_epi32(value, low_halves);
+                    _mm_store_si128(reinterpret_cast<__m128i*>(limbs), _mm256_castsi256_si128(packed));
+                }
+
+                ECG_TARGET_AVX2 static void broadcast(type& result, uint64_t value) {
+                    result = _mm256_set1_epi64x(static_cast<long long>(value));
+                }
+
+                ECG_TARGET_AVX2 static void add(type& result, const type& lhs, const type& rhs) {
+                    result = _mm256_add_epi64(lhs, rhs);
+                }
+
+                ECG_TARGET_AVX2 static void sub(type& result, const type& lhs, const type& rhs) {
+                    result = _mm256_sub_epi64(lhs, rhs);
+                }
+
+                ECG_TARGET_AVX2 static void mul(type& result, const type& lhs, const type& rhs) {
+                    result = _mm256_mul_epu32(lhs, rhs);
+                }
+
+                ECG_TARGET_AVX2 static void low(type& result, const type& value) {
+                    result = _mm256_and_si256(value, _mm256_set1_epi64x(0xffffffff));
+                }
+
+                ECG_TARGET_AVX2 static void high(type& result, const type& value) {
+                    result = _mm256_srli_epi64(value, 32);
+                }
+
+                ECG_TARGET_AVX2 static void negative(type& result, const type& value) {
+                    result = _mm256_cmpgt_epi64(_mm256_setzero_si256(), value);
+                }
+
+                ECG_TARGET_AVX2 static void is_zero(type& result, const type& value) {
+                    result = _mm256_cmpeq_epi64(value, _mm256_setzero_si256());
+                }
+
+                ECG_TARGET_AVX2 static void bit_or(type& result, const type& lhs, const type& rhs) {
+                    result = _mm256_or_si256(lhs, rhs);
+                }
+
+                ECG_TARGET_AVX2 static void select(type& result, const type& mask, const type& lhs,
+                                                   const type& rhs) {
+                    result = _mm256_blendv_epi8(rhs, lhs, mask);
+                }
+            };
+
+            struct Avx512Lanes {
+                using type = __m512i;
+                static constexpr size_t c_lanes = 8;
+
+                ECG_TARGET_AVX512 static void load(type& result, const uint32_t* limbs) {
+                    const __m256i packed = _mm256_load_si256(reinterpret_cast<const __m256i*>(limbs));
+                    result = _mm512_cvtepu32_epi64(packed);
+                }
+
+                ECG_TARGET_AVX512 static void store(uint32_t* limbs, const type& value) {
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(limbs), _mm512_cvtepi64_epi32(value));
+                }
+
+                ECG_TARGET_AVX512 static void broadcast(type& result, uint64_t value) {
+                    result = _mm512_set1_epi64(static_cast<long long>(value));
+                }
+
+                ECG_TARGET_AVX512 static void add(type& result, const type& lhs, const type& rhs) {
+                    result = _mm512_add_epi64(lhs, rhs);
+                }
+
+                ECG_TARGET_AVX512 static void sub(type& result, const type& lhs, const type& rhs) {
+                    result = _mm512_sub_epi64(lhs, rhs);
+                }
+
+                ECG_TARGET_AVX512 static void mul(type& result, const type& lhs, const type& rhs) {
+                    result = _mm512_mul_epu32(lhs, rhs);
+                }
+
+                ECG_TARGET_AVX512 static void low(type& result, const type& value) {
+                    result = _mm512_and_si512(value, _mm512_set1_epi64(0xffffffff));
+                }
+
+                ECG_TARGET_AVX512 static void high(type& result, const type& value) {
+                    result = _mm512_srli_epi64(value, 32);
+                }
+
+                ECG_TARGET_AVX512 static void negative(type& result, const type& value) {
+                    result = _mm512_srai_epi64(value, 63);
+                }
+
+                ECG_TARGET_AVX512 static void is_zero(type& result, const type& value) {
+                    result = _mm512_maskz_set1_epi64(_mm512_testn_epi64_mask(value, value), -1);
+                }
+
+                ECG_TARGET_AVX512 static void bit_or(type& result, const type& lhs, const type& rhs) {
+                    result = _mm512_or_si512(lhs, rhs);
+                }
+
+                ECG_TARGET_AVX512 static void select(type& result, const type& mask, const type& lhs,
+                                                     const type& rhs) {
+                    result = _mm512_mask_blend_epi64(_mm512_test_epi64_mask(mask, mask), rhs, lhs);
+                }
+            };
+#endif
+
+            // Limbs start at the alignment of the widest load, and so do the sets of lanes in rows of limbs
+            // whose length is a multiple of c_alignment / 4
+            template<typename T>
+            struct AlignedAllocator {
+                using value_type = T;
+                static constexpr size_t c_alignment = 64;
+
+                AlignedAllocator() = default;
+
+                template<typename U>
+                AlignedAllocator(const AlignedAllocator<U>&) {}
+
+                T* allocate(size_t n) {
+                    return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(c_alignment)));
+                }
+
+                void deallocate(T* pointer, size_t) {
+                    ::operator delete(pointer, std::align_val_t(c_alignment));
+                }
+
+                template<typename U>
+                bool operator==(const AlignedAllocator<U>&) const {
+                    return true;
+                }
+            };
+
+            using AlignedLimbs = std::vector<uint32_t, AlignedAllocator<uint32_t>>;
+
+            // The values of one set of lanes: limb j of lane k is at data[j * stride + k]
+            struct ConstRow {
+                const uint32_t* data;
+                size_t stride;
+            };
+
+            struct Row {
+                uint32_t* data;
+                size_t stride;
+
+                operator ConstRow() const {
+                    return {data, stride};
+                }
+            };
+
+            // An odd modulus of size 32-bit limbs, inverse = -modulus^-1 mod 2^32
+            struct Modulus {
+                const uint32_t* limbs;
+                size_t size;
+                uint32_t inverse;
+            };
+
+            // Values are less than modulus and kept in Montgomery form with R = 2^(32 * size), c_max_limbs
+            // bounds size. Every kernel reads all of its operands before it writes result, so result may be
+            // one of them. The kernels are always inlined, into the entries below for the vector lanes, so
+            // they run with the extension of the entry
+            template<typename Lanes, size_t c_max_limbs>
+            class Kernels {
+                using type = typename Lanes::type;
+                using Limbs = std::array<type, c_max_limbs + 2>;
+
+                // result = value - modulus if value = low + top * R is at least modulus, and value otherwise.
+                // value must be less than 2 * modulus
+                ECG_FORCE_INLINE static void reduce_once(const Limbs& low, const type& top,
+                                                         const Limbs& modulus, size_t size, Row result) {
+                    Limbs difference;
+                    type borrow;
+                    type limb;
+                    Lanes::broadcast(borrow, 0);
+
+                    for (size_t j = 0; j < size; ++j) {
+                        Lanes::sub(limb, low[j], modulus[j]);
+                        Lanes::sub(limb, limb, borrow);
+                        borrow_of(borrow, limb);
+                        Lanes::low(difference[j], limb);
+                    }
+
+                    type keep;
+                    Lanes::sub(keep, top, borrow);
+                    Lanes::negative(keep, keep);
+
+                    for (size_t j = 0; j < size; ++j) {
+                        Lanes::select(limb, keep, low[j], difference[j]);
+                        Lanes::store(result.data + j * result.stride, limb);
+                    }
+                }
+
+                // 1 in the lanes where a subtraction went below zero
+                ECG_FORCE_INLINE static void borrow_of(type& result, const type& limb) {
+                    type zero;
+                    Lanes::broadcast(zero, 0);
+                    Lanes::negative(result, limb);
+                    Lanes::sub(result, zero, result);
+                }
+
+                ECG_FORCE_INLINE static void broadcast(Limbs& result, const Modulus& modulus) {
+                    for (size_t j = 0; j < modulus.size; ++j) {
+                        Lanes::broadcast(result[j], modulus.limbs[j]);
+                    }
+                }
+
+                ECG_FORCE_INLINE static void is_zero(type& result, ConstRow row, size_t size) {
+                    type bits;
+                    type limb;
+                    Lanes::broadcast(bits, 0);
+
+                    for (size_t j = 0; j < size; ++j) {
+                        Lanes::load(limb, row.data + j * row.stride);
+                        Lanes::bit_or(bits, bits, limb);
+                    }
+
+                    Lanes::is_zero(result, bits);
+                }
+
+                // Writes source to the lanes of destination where mask is all ones
+                ECG_FORCE_INLINE static void replace(ConstRow source, Row destination, size_t size,
+                                                     const type& mask) {
+                    type value;
+                    type current;
+
+                    for (size_t j = 0; j < size; ++j) {
+                        uint32_t* limb = destination.data + j * destination.stride;
+                        Lanes::load(value, source.data + j * source.stride);
+                        Lanes::load(current, limb);
+                        Lanes::select(current, mask, value, current);
+                        Lanes::store(limb, current);
+                    }
+                }
+
+            public:
+                static constexpr size_t c_lanes = Lanes::c_lanes;
+
+                ECG_FORCE_INLINE static void add(ConstRow lhs, ConstRow rhs, Row result,
+                                                 const Modulus& modulus) {
+                    Limbs p;
+                    Limbs sum;
+                    type carry;
+                    type limb;
+                    type addend;
+                    broadcast(p, modulus);
+                    Lanes::broadcast(carry, 0);
+
+                    for (size_t j = 0; j < modulus.size; ++j) {
+                        Lanes::load(limb, lhs.data + j * lhs.stride);
+                        Lanes::load(addend, rhs.data + j * rhs.stride);
+                        Lanes::add(limb, limb, addend);
+                        Lanes::add(limb, limb, carry);
+                        Lanes::low(sum[j], limb);
+                        Lanes::high(carry, limb);
+                    }
+
+                    reduce_once(sum, carry, p, modulus.size, result);
+                }
+
+                // A borrow out of the top limb means lhs < rhs, then modulus is added back
+                ECG_FORCE_INLINE static void subtract(ConstRow lhs, ConstRow rhs, Row result,
+                                                      const Modulus& modulus) {
+                    Limbs p;
+                    Limbs difference;
+                    type borrow;
+                    type limb;
+                    type subtrahend;
+                    broadcast(p, modulus);
+                    Lanes::broadcast(borrow, 0);
+
+                    for (size_t j = 0; j < modulus.size; ++j) {
+                        Lanes::load(limb, lhs.data + j * lhs.stride);
+                        Lanes::load(subtrahend, rhs.data + j * rhs.stride);
+                        Lanes::sub(limb, limb, subtrahend);
+                        Lanes::sub(limb, limb, borrow);
+                        borrow_of(borrow, limb);
+                        Lanes::low(difference[j], limb);
+                    }
+
+                    type zero;
+                    type mask;
+                    type carry;
+                    Lanes::broadcast(zero, 0);
+                    Lanes::sub(mask, zero, borrow);
+                    Lanes::broadcast(carry, 0);
+
+                    for (size_t j = 0; j < modulus.size; ++j) {
+                        Lanes::select(limb, mask, p[j], zero);
+                        Lanes::add(limb, difference[j], limb);
+                        Lanes::add(limb, limb, carry);
+                        Lanes::high(carry, limb);
+                        Lanes::low(limb, limb);
+                        Lanes::store(result.data + j * result.stride, limb);
+                    }
+                }
+
+                // Coarsely integrated operand scanning, as montgomery::multiply does for a single value
+                ECG_FORCE_INLINE static void multiply(ConstRow lhs, ConstRow rhs, Row result,
+                                                      const Modulus& modulus) {
+                    const size_t n = modulus.size;
+                    Limbs p;
+                    Limbs a;
+                    Limbs t;
+                    type inverse;
+                    broadcast(p, modulus);
+                    Lanes::broadcast(inverse, modulus.inverse);
+
+                    for (size_t j = 0; j < n; ++j) {
+                        Lanes::load(a[j], lhs.data + j * lhs.stride);
+                        Lanes::broadcast(t[j], 0);
+                    }
+
+                    Lanes::broadcast(t[n], 0);
+                    Lanes::broadcast(t[n + 1], 0);
+
+                    type b;
+                    type carry;
+                    type limb;
+                    type factor;
+
+                    for (size_t i = 0; i < n; ++i) {
+                        Lanes::load(b, rhs.data + i * rhs.stride);
+                        Lanes::broadcast(carry, 0);
+
+                        for (size_t j = 0; j < n; ++j) {
+                            Lanes::mul(limb, a[j], b);
+                            Lanes::add(limb, limb, t[j]);
+                            Lanes::add(limb, limb, carry);
+                            Lanes::low(t[j], limb);
+                            Lanes::high(carry, limb);
+                        }
+
+                        Lanes::add(limb, t[n], carry);
+                        Lanes::low(t[n], limb);
+                        Lanes::high(t[n + 1], limb);
+
+                        // factor * modulus clears the lowest limb, which is then shifted out
+                        Lanes::mul(factor, t[0], inverse);
+                        Lanes::low(factor, factor);
+                        Lanes::mul(limb, factor, p[0]);
+                        Lanes::add(limb, limb, t[0]);
+                        Lanes::high(carry, limb);
+
+                        for (size_t j = 1; j < n; ++j) {
+                            Lanes::mul(limb, factor, p[j]);
+                            Lanes::add(limb, limb, t[j]);
+                            Lanes::add(limb, limb, carry);
+                            Lanes::low(t[j - 1], limb);
+                            Lanes::high(carry, limb);
+                        }
+
+                        Lanes::add(limb, t[n], carry);
+                        Lanes::low(t[n - 1], limb);
+                        Lanes::high(limb, limb);
+                        Lanes::add(t[n], t[n + 1], limb);
+                    }
+
+                    reduce_once(t, t[n], p, n, result);
+                }
+
+                // Writes source to the lanes where destination is zero
+                ECG_FORCE_INLINE static void replace_zero(ConstRow source, Row destination, size_t size) {
+                    type mask;
+                    is_zero(mask, destination, size);
+                    replace(source, destination, size, mask);
+                }
+
+                // Writes source to the lanes where destination is not zero
+                ECG_FORCE_INLINE static void replace_non_zero(ConstRow source, Row destination, size_t size) {
+                    type mask;
+                    is_zero(mask, destination, size);
+                    Lanes::is_zero(mask, mask);
+                    replace(source, destination, size, mask);
+                }
+            };
+
+            // The widest extension that both the processor and the operating system support, detected once
+            enum class Extension {
+                None,
+                Avx2,
+                Avx512,
+            };
+
+            Extension supported_extension();
+
+            // The lanes of the widest supported extension, chosen at run time
+            struct DispatchedLanes {};
+
+            // Sets of lanes of any policy start at multiples of c_max_lanes limbs
+            static constexpr size_t c_max_lanes = 8;
+
+            // The kernels of one policy behind plain pointers, so that a vector can choose them at run time
+            struct KernelTable {
+                size_t lanes;
+                void (*add)(ConstRow lhs, ConstRow rhs, Row result, const Modulus& modulus);
+                void (*subtract)(ConstRow lhs, ConstRow rhs, Row result, const Modulus& modulus);
+                void (*multiply)(ConstRow lhs, ConstRow rhs, Row result, const Modulus& modulus);
+                void (*replace_zero)(ConstRow source, Row destination, size_t size);
+                void (*replace_non_zero)(ConstRow source, Row destination, size_t size);
+            };
+
+            // The entries of the table, compiled with the extension of Lanes
+            template<typename Lanes, size_t c_max_limbs>
+            struct KernelEntries {
+                using Kernels = lanes::Kernels<Lanes, c_max_limbs>;
+
+                static constexpr KernelTable c_table = {.lanes = Lanes::c_lanes,
+                                                        .add = Kernels::add,
+                                                        .subtract = Kernels::subtract,
+                                                        .multiply = Kernels::multiply,
+                                                        .replace_zero = Kernels::replace_zero,
+                                                        .replace_non_zero = Kernels::replace_non_zero};
+            };
+
+#ifdef ECG_HAS_X86_LANES
+            template<size_t c_max_limbs>
+            struct KernelEntries<Avx2Lanes, c_max_limbs> {
+                using Kernels = lanes::Kernels<Avx2Lanes, c_max_limbs>;
+
+                ECG_TARGET_AVX2 static void add(ConstRow lhs, ConstRow rhs, Row result,
+                                                const Modulus& modulus) {
+                    Kernels::add(lhs, rhs, result, modulus);
+                }
+
+                ECG_TARGET_AVX2 static void subtract(ConstRow lhs, ConstRow rhs, Row result,
+                                                     const Modulus& modulus) {
+                    Kernels::subtract(lhs, rhs, result, modulus);
+                }
+
+                ECG_TARGET_AVX2 static void multiply(ConstRow lhs, ConstRow rhs, Row result,
+                                                     const Modulus& modulus) {
+                    Kernels::multiply(lhs, rhs, result, modulus);
+                }
+
+                ECG_TARGET_AVX2 static void replace_zero(ConstRow source, Row destination, size_t size) {
+                    Kernels::replace_zero(source, destination, size);
+                }
+
+                ECG_TARGET_AVX2 static void replace_non_zero(ConstRow source, Row destination, size_t size) {
+                    Kernels::replace_non_zero(source, destination, size);
+                }
+
+                static constexpr KernelTable c_table = {.lanes = Avx2Lanes::c_lanes,
+                                                        .add = add,
+                                                        .subtract = subtract,
+                                                        .multiply = multiply,
+                                                        .replace_zero = replace_zero,
+                                                        .replace_non_zero = replace_non_zero};
+            };
+
+            template<size_t c_max_limbs>
+            struct KernelEntries<Avx512Lanes, c_max_limbs> {
+                using Kernels = lanes::Kernels<Avx512Lanes, c_max_limbs>;
+
+                ECG_TARGET_AVX512 static void add(ConstRow lhs, ConstRow rhs, Row result,
+                                                  const Modulus& modulus) {
+                    Kernels::add(lhs, rhs, result, modulus);
+                }
+
+                ECG_TARGET_AVX512 static void subtract(ConstRow lhs, ConstRow rhs, Row result,
+                                                       const Modulus& modulus) {
+                    Kernels::subtract(lhs, rhs, result, modulus);
+                }
+
+                ECG_TARGET_AVX512 static void multiply(ConstRow lhs, ConstRow rhs, Row result,
+                                                       const Modulus& modulus) {
+                    Kernels::multiply(lhs, rhs, result, modulus);
+                }
+
+                ECG_TARGET_AVX512 static void replace_zero(ConstRow source, Row destination, size_t size) {
+                    Kernels::replace_zero(source, destination, size);
+                }
+
+                ECG_TARGET_AVX512 static void replace_non_zero(ConstRow source, Row destination,
+                                                               size_t size) {
+                    Kernels::replace_non_zero(source, destination, size);
+                }
+
+                static constexpr KernelTable c_table = {.lanes = Avx512Lanes::c_lanes,
+                                                        .add = add,
+                                                        .subtract = subtract,
+                                                        .multiply = multiply,
+                                                        .replace_zero = replace_zero,
+                                                        .replace_non_zero = replace_non_zero};
+            };
+#endif
+
+            // The kernels of Lanes, or of the widest supported extension for DispatchedLanes
+            template<typename Lanes, size_t c_max_limbs>
+            const KernelTable& kernel_table() {
+                if constexpr (std::is_same_v<Lanes, DispatchedLanes>) {
+#ifdef ECG_HAS_X86_LANES
+                    const Extension extension = supported_extension();
+
+                    if (extension == Extension::Avx512) {
+                        return KernelEntries<Avx512Lanes, c_max_limbs>::c_table;
+                    }
+
+                    if (extension == Extension::Avx2) {
+                        return KernelEntries<Avx2Lanes, c_max_limbs>::c_table;
+                    }
+#endif
+                    return KernelEntries<ScalarLanes, c_max_limbs>::c_table;
+                } else {
+                    return KernelEntries<Lanes, c_max_limbs>::c_table;
+                }
+            }
+        }   // namespace lanes
+    }       // namespace algorithm
+}   // namespace elliptic_curve_guide
+#endif
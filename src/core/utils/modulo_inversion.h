@@ -3,40 +3,75 @@
 
 #include "uint.h"
 
+#include <cassert>
+#include <utility>
+
 namespace elliptic_curve_guide {
     namespace algorithm {
+        // Binary GCD for types without their own kernel: value * u = a and value * v = b modulo modulus, a
+        // and b are halved and subtracted until a vanishes. The modulus must be odd, value must be less
+        // than modulus
         template<typename T>
-        static T extended_modular_gcd(const T& a, const T& b, T& x, T& y, const T& modulus) {
-            if (b == 0) {
-                x = 1;
-                y = 0;
-                return a;
-            }
+        T inverse_odd_modulo(const T& value, const T& modulus) {
+            // x / 2 mod modulus, (x + modulus) / 2 is written so that it does not overflow
+            const auto halve = [&modulus](const T& x) {
+                return (x & 1) == 0 ? T(x >> 1) : T((x >> 1) + (modulus >> 1) + 1);
+            };
 
-            T x1, y1;
-            T d = extended_modular_gcd<T>(b, a % b, x1, y1, modulus);
-            x = y1;
-            T temp = y1 * (a / b);
+            T a = value;
+            T b = modulus;
+            T u = 1;
+            T v = 0;
 
-            while (x1 < temp) {
-                x1 += modulus;
-            }
+            while (a != 0) {
+                if ((a & 1) != 0) {
+                    if (a < b) {
+                        std::swap(a, b);
+                        std::swap(u, v);
+                    }
 
-            y = x1 - temp;
+                    a -= b;
+                    u = u >= v ? T(u - v) : T(u + (modulus - v));
+                }
 
-            while (y >= modulus) {
-                y -= modulus;
+                a >>= 1;
+                u = halve(u);
             }
 
-            return d;
+            return v;
+        }
+
+        // An answer is checked in the wide type of T where there is one, since a modulus may take the full
+        // width of T
+        template<typename T>
+        bool is_inverse_modulo(const T& result, const T& value, const T& modulus) {
+            if constexpr (requires { typename uint_traits<T>::wide; }) {
+                using wide_type = typename uint_traits<T>::wide;
+                return wide_type(result) * wide_type(value) % wide_type(modulus) == 1;
+            } else {
+                return (result * value) % modulus == 1;
+            }
         }
 
+        // Odd moduli go through inverse_odd_modulo, uint_t has its own batched kernel for it. An even modulus
+        // is reduced to the odd modulus value, then modulus * value must fit into T
         template<typename T>
         T inverse_modulo(const T& value, const T& modulus) {
-            T result, temp;
-            extended_modular_gcd<T>(value, modulus, result, temp, modulus);
+            T result;
+
+            if ((modulus & 1) != 0) {
+                result = inverse_odd_modulo(value < modulus ? value : T(value % modulus), modulus);
+            } else if (value == 1) {
+                result = 1;
+            } else {
+                // value is odd, so modulus * t = 1 + k * value for t = modulus^-1 mod value, and -k is the
+                // answer: result = (1 + modulus * (value - t)) / value
+                const T t = inverse_odd_modulo(modulus % value, value);
+                result = (modulus * (value - t) + 1) / value;
+            }
+
             assert(result < modulus && "inverse_modulo : value must be less than modulus");
-            assert((result * value) % modulus == 1 && "inverse_modulo : incorrect answer");
+            assert(is_inverse_modulo(result, value, modulus) && "inverse_modulo : incorrect answer");
             return result;
         }
     }   // namespace algorithm
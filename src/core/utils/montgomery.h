@@ -0,0 +1,141 @@
+#ifndef ECG_MONTGOMERY_H
+#define ECG_MONTGOMERY_H
+
+#include "digit-arithmetic.h"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace elliptic_curve_guide {
+    namespace algorithm {
+        namespace montgomery {
+            // Returns -modulus^-1 mod b for an odd modulus, Newton's iteration doubles the number of correct
+            // bits and modulus is its own inverse modulo 8
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr digit_t inverse(digit_t modulus) {
+                digit_t result = modulus;
+
+                for (size_t bits = 3; bits < digit::c_digit_size<digit_t>; bits *= 2) {
+                    result *= static_cast<digit_t>(2) - modulus * result;
+                }
+
+                return static_cast<digit_t>(0) - result;
+            }
+
+            // Coarsely integrated operand scanning (Koc, Acar, Kaliski): writes lhs * rhs / b^size mod
+            // modulus into the first size digits of result, which must hold size + 2 digits. Operands of size
+            // digits must be less than modulus, inverse is inverse(modulus[0])
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr void multiply(const digit_t* lhs, const digit_t* rhs, const digit_t* modulus,
+                                    size_t size, digit_t inverse, digit_t* result) {
+                std::fill(result, result + size + 2, digit_t(0));
+
+                for (size_t i = 0; i < size; ++i) {
+                    digit_t carry = 0;
+
+                    for (size_t j = 0; j < size; ++j) {
+                        result[j] = digit::mul_add(lhs[j], rhs[i], result[j], carry);
+                    }
+
+                    digit_t top_carry = 0;
+                    result[size] = digit::add(result[size], carry, top_carry);
+                    result[size + 1] = top_carry;
+
+                    // factor * modulus clears the lowest digit, which is then shifted out
+                    const digit_t factor = result[0] * inverse;
+                    carry = 0;
+                    digit::mul_add(factor, modulus[0], result[0], carry);
+
+                    for (size_t j = 1; j < size; ++j) {
+                        result[j - 1] = digit::mul_add(factor, modulus[j], result[j], carry);
+                    }
+
+                    top_carry = 0;
+                    result[size - 1] = digit::add(result[size], carry, top_carry);
+                    result[size] = result[size + 1] + top_carry;
+                }
+
+                // The sum is less than 2 * modulus, so at most one subtraction is needed
+                bool is_reduced = result[size] == 0;
+
+                if (is_reduced) {
+                    size_t pos = size;
+
+                    while (pos > 0 && result[pos - 1] == modulus[pos - 1]) {
+                        --pos;
+                    }
+
+                    is_reduced = pos > 0 && result[pos - 1] < modulus[pos - 1];
+                }
+
+                if (!is_reduced) {
+                    digit_t borrow = 0;
+
+                    for (size_t i = 0; i < size; ++i) {
+                        result[i] = digit::sub(result[i], modulus[i], borrow);
+                    }
+                }
+            }
+
+            // Montgomery reduction of a whole value of value_size >= 2 * size digits: multiples of modulus
+            // clear its low size digits, the rest is less than value / b^size + modulus and is brought below
+            // modulus by subtractions, so value should be at most a few times modulus * b^size. The result
+            // is left in the size digits at value + size, value must hold value_size + 1 digits
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr void reduce(digit_t* value, size_t value_size, const digit_t* modulus, size_t size,
+                                  digit_t inverse) {
+                value[value_size] = 0;
+
+                for (size_t i = 0; i < size; ++i) {
+                    const digit_t factor = value[i] * inverse;
+                    digit_t carry = 0;
+
+                    for (size_t j = 0; j < size; ++j) {
+                        value[i + j] = digit::mul_add(factor, modulus[j], value[i + j], carry);
+                    }
+
+                    for (size_t j = i + size; carry != 0 && j <= value_size; ++j) {
+                        digit_t add_carry = 0;
+                        value[j] = digit::add(value[j], carry, add_carry);
+                        carry = add_carry;
+                    }
+                }
+
+                digit_t* result = value + size;
+                const size_t result_size = value_size + 1 - size;
+
+                while (true) {
+                    size_t pos = result_size;
+
+                    while (pos > size && result[pos - 1] == 0) {
+                        --pos;
+                    }
+
+                    if (pos == size) {
+                        while (pos > 0 && result[pos - 1] == modulus[pos - 1]) {
+                            --pos;
+                        }
+
+                        if (pos > 0 && result[pos - 1] < modulus[pos - 1]) {
+                            return;
+                        }
+                    }
+
+                    digit_t borrow = 0;
+
+                    for (size_t i = 0; i < size; ++i) {
+                        result[i] = digit::sub(result[i], modulus[i], borrow);
+                    }
+
+                    for (size_t i = size; borrow != 0 && i < result_size; ++i) {
+                        result[i] = digit::sub(result[i], digit_t(0), borrow);
+                    }
+                }
+            }
+        }   // namespace montgomery
+    }       // namespace algorithm
+}   // namespace elliptic_curve_guide
+#endif
@@ -0,0 +1,206 @@
+#ifndef ECG_MULTIPLICATION_H
+#define ECG_MULTIPLICATION_H
+
+#include "digit-arithmetic.h"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace elliptic_curve_guide {
+    namespace algorithm {
+        namespace multiplication {
+            // Operands with at least this many digits go through Karatsuba. Picked by measuring mul_wide on
+            // uint_t<2048> to uint_t<8192> with thresholds from 8 to 48 digits, for both digit types
+            constexpr size_t c_karatsuba_threshold = 32;
+
+            // Upper bound of the buffer used by karatsuba for operands of size digits
+            constexpr size_t karatsuba_buffer_size(size_t size) {
+                return 6 * size;
+            }
+
+            // Product scanning: column k of the result accumulates every lhs[i] * rhs[k - i] at once,
+            // so each result digit is written exactly once. Columns past result_size are dropped
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr void comba(const digit_t* lhs, size_t lhs_size, const digit_t* rhs, size_t rhs_size,
+                                 digit_t* result, size_t result_size) {
+                if (lhs_size == 0 || rhs_size == 0) {
+                    std::fill(result, result + result_size, digit_t(0));
+                    return;
+                }
+
+                const size_t columns_number = std::min(lhs_size + rhs_size, result_size);
+                digit_t low = 0;
+                digit_t middle = 0;
+                digit_t high = 0;
+
+                for (size_t k = 0; k < columns_number; ++k) {
+                    const size_t first = k < rhs_size ? 0 : k - rhs_size + 1;
+                    const size_t last = std::min(k + 1, lhs_size);
+
+                    for (size_t i = first; i < last; ++i) {
+                        digit::mul_accumulate(lhs[i], rhs[k - i], low, middle, high);
+                    }
+
+                    result[k] = low;
+                    low = middle;
+                    middle = high;
+                    high = 0;
+                }
+
+                std::fill(result + columns_number, result + result_size, digit_t(0));
+            }
+
+            // Comba for lhs == rhs: every cross product value[i] * value[j], i < j, appears twice in its
+            // column, so it is computed once and the column sum is doubled before adding the diagonal square
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr void comba_square(const digit_t* value, size_t size, digit_t* result,
+                                        size_t result_size) {
+                constexpr size_t c_top_shift = digit::c_digit_size<digit_t> - 1;
+                const size_t columns_number = std::min(2 * size, result_size);
+                digit_t low = 0;
+                digit_t middle = 0;
+                digit_t high = 0;
+
+                for (size_t k = 0; k < columns_number; ++k) {
+                    const size_t first = k < size ? 0 : k - size + 1;
+                    digit_t column_low = 0;
+                    digit_t column_middle = 0;
+                    digit_t column_high = 0;
+
+                    for (size_t i = first; 2 * i < k; ++i) {
+                        digit::mul_accumulate(value[i], value[k - i], column_low, column_middle, column_high);
+                    }
+
+                    column_high = (column_high << 1) | (column_middle >> c_top_shift);
+                    column_middle = (column_middle << 1) | (column_low >> c_top_shift);
+                    column_low <<= 1;
+
+                    if (k % 2 == 0) {
+                        digit::mul_accumulate(value[k / 2], value[k / 2], column_low, column_middle,
+                                              column_high);
+                    }
+
+                    digit_t carry = 0;
+                    low = digit::add(low, column_low, carry);
+                    middle = digit::add(middle, column_middle, carry);
+                    high += column_high + carry;
+
+                    result[k] = low;
+                    low = middle;
+                    middle = high;
+                    high = 0;
+                }
+
+                std::fill(result + columns_number, result + result_size, digit_t(0));
+            }
+
+            // Writes |lhs - rhs| of size digits into result, returns true if lhs < rhs
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr bool subtract_absolute(const digit_t* lhs, const digit_t* rhs, size_t size,
+                                             digit_t* result) {
+                size_t pos = size;
+
+                while (pos > 0 && lhs[pos - 1] == rhs[pos - 1]) {
+                    --pos;
+                }
+
+                const bool is_negative = pos > 0 && lhs[pos - 1] < rhs[pos - 1];
+
+                if (is_negative) {
+                    std::swap(lhs, rhs);
+                }
+
+                digit_t borrow = 0;
+
+                for (size_t i = 0; i < size; ++i) {
+                    result[i] = digit::sub(lhs[i], rhs[i], borrow);
+                }
+
+                return is_negative;
+            }
+
+            // Subtractive Karatsuba: lhs * rhs with both operands of size digits, result has 2 * size digits.
+            // With lhs = a1 B^h + a0 and rhs = b1 B^h + b0 the middle term is
+            // a0 b0 + a1 b1 + (a1 - a0)(b0 - b1), so every recursive product stays unsigned and of the same
+            // size. buffer must hold karatsuba_buffer_size(size) digits
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr void karatsuba(const digit_t* lhs, const digit_t* rhs, size_t size, digit_t* result,
+                                     digit_t* buffer) {
+                if (size < c_karatsuba_threshold) {
+                    comba(lhs, size, rhs, size, result, 2 * size);
+                    return;
+                }
+
+                const size_t low_size = size / 2;
+                const size_t high_size = size - low_size;
+
+                // a0 b0 and a1 b1 go straight into their places in the result
+                karatsuba(lhs, rhs, low_size, result, buffer);
+                karatsuba(lhs + low_size, rhs + low_size, high_size, result + 2 * low_size, buffer);
+
+                // a0 and b0 are zero-extended to high_size digits
+                digit_t* lhs_difference = buffer;
+                digit_t* rhs_difference = buffer + high_size;
+                digit_t* low_extended = buffer + 2 * high_size;
+
+                std::copy(lhs, lhs + low_size, low_extended);
+                low_extended[low_size] = 0;
+                const bool is_lhs_negative =
+                    subtract_absolute(lhs + low_size, low_extended, high_size, lhs_difference);
+
+                std::copy(rhs, rhs + low_size, low_extended);
+                low_extended[low_size] = 0;
+                const bool is_rhs_negative =
+                    subtract_absolute(low_extended, rhs + low_size, high_size, rhs_difference);
+
+                digit_t* difference_product = buffer + 2 * high_size;
+                karatsuba(lhs_difference, rhs_difference, high_size, difference_product,
+                          buffer + 4 * high_size);
+
+                // middle = a0 b0 + a1 b1 +- |a1 - a0| |b0 - b1|, it is non-negative and fits in
+                // 2 * high_size + 1 digits
+                const size_t middle_size = 2 * high_size + 1;
+                digit_t* middle = buffer + 4 * high_size;
+                digit_t carry = 0;
+
+                for (size_t i = 0; i < middle_size - 1; ++i) {
+                    const digit_t low_part = i < 2 * low_size ? result[i] : digit_t(0);
+                    middle[i] = digit::add(low_part, result[2 * low_size + i], carry);
+                }
+
+                middle[middle_size - 1] = carry;
+
+                if (is_lhs_negative == is_rhs_negative) {
+                    carry = 0;
+
+                    for (size_t i = 0; i < middle_size; ++i) {
+                        const digit_t part = i < 2 * high_size ? difference_product[i] : digit_t(0);
+                        middle[i] = digit::add(middle[i], part, carry);
+                    }
+                } else {
+                    digit_t borrow = 0;
+
+                    for (size_t i = 0; i < middle_size; ++i) {
+                        const digit_t part = i < 2 * high_size ? difference_product[i] : digit_t(0);
+                        middle[i] = digit::sub(middle[i], part, borrow);
+                    }
+                }
+
+                carry = 0;
+
+                for (size_t i = 0; i < middle_size; ++i) {
+                    result[low_size + i] = digit::add(result[low_size + i], middle[i], carry);
+                }
+
+                for (size_t i = low_size + middle_size; carry != 0 && i < 2 * size; ++i) {
+                    result[i] = digit::add(result[i], digit_t(0), carry);
+                }
+            }
+        }   // namespace multiplication
+    }       // namespace algorithm
+}   // namespace elliptic_curve_guide
+#endif
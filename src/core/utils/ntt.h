@@ -0,0 +1,236 @@
+#ifndef ECG_NTT_H
+#define ECG_NTT_H
+
+#include "digit-arithmetic.h"
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace elliptic_curve_guide {
+    namespace algorithm {
+        namespace number_theoretic_transform {
+            // Convolutions are computed modulo three primes c * 2^k + 1 and glued together by CRT. The
+            // product of the primes exceeds 2^86, so every coefficient of a product of 32-bit words stays
+            // exact while the shorter operand has less than 2^22 words
+            constexpr size_t c_primes_number = 3;
+            constexpr std::array<uint32_t, c_primes_number> c_primes = {998244353, 167772161, 469762049};
+            constexpr uint32_t c_primitive_root = 3;
+            constexpr size_t c_max_log_size = 23;
+
+            // Both operands need at least this many 32-bit words before multiply beats Karatsuba, measured on
+            // uint_t<65536> to uint_t<262144>
+            constexpr size_t c_threshold = 4096;
+
+            constexpr uint32_t mul_mod(uint32_t lhs, uint32_t rhs, uint32_t modulus) {
+                return static_cast<uint32_t>(static_cast<uint64_t>(lhs) * rhs % modulus);
+            }
+
+            constexpr uint32_t pow_mod(uint32_t value, uint64_t power, uint32_t modulus) {
+                uint32_t result = 1;
+
+                while (power > 0) {
+                    if ((power & 1) != 0) {
+                        result = mul_mod(result, value, modulus);
+                    }
+
+                    value = mul_mod(value, value, modulus);
+                    power >>= 1;
+                }
+
+                return result;
+            }
+
+            // Montgomery multiplication with R = 2^32 replaces the 64-bit division in the butterflies
+            constexpr uint32_t to_montgomery(uint32_t value, uint32_t modulus) {
+                return static_cast<uint32_t>((static_cast<uint64_t>(value) << 32) % modulus);
+            }
+
+            // Returns -modulus^-1 mod 2^32, Newton's iteration doubles the number of correct bits
+            constexpr uint32_t montgomery_inverse(uint32_t modulus) {
+                uint32_t inverse = modulus;
+
+                for (size_t i = 0; i < 4; ++i) {
+                    inverse *= 2 - modulus * inverse;
+                }
+
+                return static_cast<uint32_t>(0) - inverse;
+            }
+
+            struct PrimeTable {
+                uint32_t modulus;
+                uint32_t inverse;                                         // -modulus^-1 mod 2^32
+                std::array<uint32_t, c_max_log_size + 1> roots;           // roots[k] has order 2^k, times R
+                std::array<uint32_t, c_max_log_size + 1> inverse_roots;   // roots[k]^-1, times R
+            };
+
+            constexpr PrimeTable make_prime_table(uint32_t modulus) {
+                PrimeTable table = {.modulus = modulus,
+                                    .inverse = montgomery_inverse(modulus),
+                                    .roots = {},
+                                    .inverse_roots = {}};
+
+                for (size_t k = 0; k <= c_max_log_size; ++k) {
+                    const uint32_t root = pow_mod(c_primitive_root, (modulus - 1) >> k, modulus);
+                    table.roots[k] = to_montgomery(root, modulus);
+                    table.inverse_roots[k] = to_montgomery(pow_mod(root, modulus - 2, modulus), modulus);
+                }
+
+                return table;
+            }
+
+            constexpr std::array<PrimeTable, c_primes_number> c_prime_tables = {
+                make_prime_table(c_primes[0]), make_prime_table(c_primes[1]), make_prime_table(c_primes[2])};
+
+            // Returns lhs * rhs / R mod p, operands must be less than p
+            constexpr uint32_t montgomery_mul(uint32_t lhs, uint32_t rhs, uint32_t modulus,
+                                              uint32_t inverse) {
+                const uint64_t product = static_cast<uint64_t>(lhs) * rhs;
+                const uint32_t factor = static_cast<uint32_t>(product) * inverse;
+                const uint64_t sum = product + static_cast<uint64_t>(factor) * modulus;
+                const uint32_t result = static_cast<uint32_t>(sum >> 32);
+                return result >= modulus ? result - modulus : result;
+            }
+
+            // In-place iterative Cooley-Tukey transform, values.size() must be a power of two.
+            // Twiddles are kept times R, so the butterflies work on plain residues
+            inline void transform(std::vector<uint32_t>& values, const PrimeTable& table, bool is_inverse) {
+                const uint32_t modulus = table.modulus;
+                const uint32_t inverse = table.inverse;
+                const size_t size = values.size();
+
+                for (size_t i = 1, j = 0; i < size; ++i) {
+                    size_t bit = size >> 1;
+
+                    for (; (j & bit) != 0; bit >>= 1) {
+                        j ^= bit;
+                    }
+
+                    j ^= bit;
+
+                    if (i < j) {
+                        std::swap(values[i], values[j]);
+                    }
+                }
+
+                std::vector<uint32_t> twiddles;
+                twiddles.reserve(size / 2);
+
+                for (size_t half = 1, level = 1; half < size; half <<= 1, ++level) {
+                    const uint32_t root = is_inverse ? table.inverse_roots[level] : table.roots[level];
+                    twiddles.assign(1, to_montgomery(1, modulus));
+
+                    for (size_t j = 1; j < half; ++j) {
+                        twiddles.push_back(montgomery_mul(twiddles.back(), root, modulus, inverse));
+                    }
+
+                    for (size_t start = 0; start < size; start += 2 * half) {
+                        uint32_t* low = values.data() + start;
+                        uint32_t* high = low + half;
+
+                        for (size_t j = 0; j < half; ++j) {
+                            const uint32_t u = low[j];
+                            const uint32_t v = montgomery_mul(high[j], twiddles[j], modulus, inverse);
+                            const uint32_t sum = u + v;
+                            low[j] = sum >= modulus ? sum - modulus : sum;
+                            high[j] = u >= v ? u - v : u + modulus - v;
+                        }
+                    }
+                }
+            }
+
+            // Exact product of two little-endian sequences of 32-bit words, has lhs.size() + rhs.size() words
+            inline std::vector<uint32_t> multiply(const std::vector<uint32_t>& lhs,
+                                                  const std::vector<uint32_t>& rhs) {
+                const size_t result_size = lhs.size() + rhs.size();
+                size_t size = 1;
+
+                while (size < result_size) {
+                    size <<= 1;
+                }
+
+                assert(size <= (static_cast<size_t>(1) << c_max_log_size)
+                       && "number_theoretic_transform::multiply : operands are too long");
+
+                std::array<std::vector<uint32_t>, c_primes_number> residues;
+
+                for (size_t i = 0; i < c_primes_number; ++i) {
+                    const PrimeTable& table = c_prime_tables[i];
+                    const uint32_t modulus = table.modulus;
+                    const uint32_t inverse = table.inverse;
+                    std::vector<uint32_t> lhs_values(size, 0);
+                    std::vector<uint32_t> rhs_values(size, 0);
+
+                    for (size_t j = 0; j < lhs.size(); ++j) {
+                        lhs_values[j] = lhs[j] % modulus;
+                    }
+
+                    for (size_t j = 0; j < rhs.size(); ++j) {
+                        rhs_values[j] = rhs[j] % modulus;
+                    }
+
+                    transform(lhs_values, table, false);
+                    transform(rhs_values, table, false);
+
+                    // The pointwise product loses a factor R, the final scale restores it and divides by size
+                    for (size_t j = 0; j < size; ++j) {
+                        lhs_values[j] = montgomery_mul(lhs_values[j], rhs_values[j], modulus, inverse);
+                    }
+
+                    transform(lhs_values, table, true);
+
+                    const uint32_t size_inverse =
+                        pow_mod(static_cast<uint32_t>(size % modulus), modulus - 2, modulus);
+                    const uint32_t scale = to_montgomery(to_montgomery(size_inverse, modulus), modulus);
+
+                    for (auto& value : lhs_values) {
+                        value = montgomery_mul(value, scale, modulus, inverse);
+                    }
+
+                    residues[i] = std::move(lhs_values);
+                }
+
+                // Garner's algorithm: value = r0 + p0 * t1 + p0 * p1 * t2
+                constexpr uint32_t c_p0 = c_primes[0];
+                constexpr uint32_t c_p1 = c_primes[1];
+                constexpr uint32_t c_p2 = c_primes[2];
+                constexpr uint64_t c_p0_p1 = static_cast<uint64_t>(c_p0) * c_p1;
+                constexpr uint32_t c_p0_inverse = pow_mod(c_p0 % c_p1, c_p1 - 2, c_p1);
+                constexpr uint32_t c_p0_p1_inverse =
+                    pow_mod(static_cast<uint32_t>(c_p0_p1 % c_p2), c_p2 - 2, c_p2);
+
+                std::vector<uint32_t> result(result_size, 0);
+                uint64_t carry_low = 0;
+                uint64_t carry_high = 0;
+
+                for (size_t i = 0; i < result_size; ++i) {
+                    const uint32_t r0 = residues[0][i];
+                    const uint32_t r1 = residues[1][i];
+                    const uint32_t r2 = residues[2][i];
+
+                    const uint32_t t1 = mul_mod((r1 + c_p1 - r0 % c_p1) % c_p1, c_p0_inverse, c_p1);
+                    const uint64_t x1 = r0 + static_cast<uint64_t>(c_p0) * t1;
+                    const uint32_t x1_residue = static_cast<uint32_t>(x1 % c_p2);
+                    const uint32_t t2 = mul_mod((r2 + c_p2 - x1_residue) % c_p2, c_p0_p1_inverse, c_p2);
+
+                    uint64_t high = 0;
+                    uint64_t low = digit::mul<uint64_t>(c_p0_p1, t2, high);
+                    uint64_t carry = 0;
+                    low = digit::add<uint64_t>(low, x1, carry);
+                    high += carry;
+                    carry = 0;
+                    low = digit::add<uint64_t>(low, carry_low, carry);
+                    high += carry_high + carry;
+
+                    result[i] = static_cast<uint32_t>(low);
+                    carry_low = (low >> 32) | (high << 32);
+                    carry_high = high >> 32;
+                }
+
+                return result;
+            }
+        }   // namespace number_theoretic_transform
+    }       // namespace algorithm
+}   // namespace elliptic_curve_guide
+#endif
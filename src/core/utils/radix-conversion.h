@@ -0,0 +1,239 @@
+#ifndef ECG_RADIX_CONVERSION_H
+#define ECG_RADIX_CONVERSION_H
+
+#include "digit-arithmetic.h"
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstddef>
+#include <limits>
+#include <system_error>
+
+namespace elliptic_curve_guide {
+    namespace algorithm {
+        namespace radix {
+            constexpr int c_min_base = 2;
+            constexpr int c_max_base = 36;
+            constexpr char c_symbols[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+            // Returns the value of symbol in bases up to 36, c_max_base for anything that is not a symbol
+            constexpr int symbol_value(char symbol) {
+                if (symbol >= '0' && symbol <= '9') {
+                    return symbol - '0';
+                } else if (symbol >= 'a' && symbol <= 'z') {
+                    return symbol - 'a' + 10;
+                } else if (symbol >= 'A' && symbol <= 'Z') {
+                    return symbol - 'A' + 10;
+                }
+
+                return c_max_base;
+            }
+
+            // Returns log2(base) for bases that are powers of two and 0 otherwise
+            constexpr size_t bits_per_symbol(int base) {
+                const unsigned value = static_cast<unsigned>(base);
+                return std::has_single_bit(value) ? static_cast<size_t>(std::countr_zero(value)) : 0;
+            }
+
+            // Upper bound of the number of symbols of a bits_number-bit value
+            constexpr size_t max_length(size_t bits_number, int base) {
+                const size_t bits = static_cast<size_t>(std::bit_width(static_cast<unsigned>(base))) - 1;
+                return std::max<size_t>((bits_number + bits - 1) / bits, 1);
+            }
+
+            // power = base^length is the largest power of base that fits into a digit, so one digit operation
+            // handles length symbols: 10^9 for 32-bit digits and 10^19 for 64-bit ones
+            template<typename digit_t>
+            struct Chunk {
+                digit_t power;
+                size_t length;
+            };
+
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr Chunk<digit_t> chunk(int base) {
+                const digit_t multiplier = static_cast<digit_t>(base);
+                Chunk<digit_t> result = {1, 0};
+
+                while (result.power <= std::numeric_limits<digit_t>::max() / multiplier) {
+                    result.power *= multiplier;
+                    ++result.length;
+                }
+
+                return result;
+            }
+
+            // Writes the symbols of a value of size digits in base without leading zeros, value is scratch
+            // space and is destroyed. Returns errc::value_too_large and last if the range is too short
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr std::to_chars_result to_chars(digit_t* value, size_t size, int base, char* first,
+                                                    char* last) {
+                constexpr size_t c_digit_size = digit::c_digit_size<digit_t>;
+
+                while (size > 0 && value[size - 1] == 0) {
+                    --size;
+                }
+
+                if (size == 0) {
+                    if (first == last) {
+                        return {last, std::errc::value_too_large};
+                    }
+
+                    *first = '0';
+                    return {first + 1, std::errc()};
+                }
+
+                if (const size_t bits = bits_per_symbol(base); bits != 0) {
+                    // Power-of-two bases read the symbols straight out of the digits
+                    const size_t bits_number =
+                        (size - 1) * c_digit_size + static_cast<size_t>(std::bit_width(value[size - 1]));
+                    const size_t length = (bits_number + bits - 1) / bits;
+                    const digit_t mask = static_cast<digit_t>(base - 1);
+
+                    if (static_cast<size_t>(last - first) < length) {
+                        return {last, std::errc::value_too_large};
+                    }
+
+                    for (size_t i = 0; i < length; ++i) {
+                        const size_t index = i * bits / c_digit_size;
+                        const size_t offset = i * bits % c_digit_size;
+                        digit_t part = value[index] >> offset;
+
+                        if (offset + bits > c_digit_size && index + 1 < size) {
+                            part |= value[index + 1] << (c_digit_size - offset);
+                        }
+
+                        first[length - 1 - i] = c_symbols[part & mask];
+                    }
+
+                    return {first + length, std::errc()};
+                }
+
+                // Other bases peel one chunk per division by a single digit, symbols come out lowest first
+                const Chunk<digit_t> step = chunk<digit_t>(base);
+                const digit_t multiplier = static_cast<digit_t>(base);
+                char* current = first;
+
+                while (size > 0) {
+                    digit_t remainder = 0;
+
+                    for (size_t i = size; i > 0; --i) {
+                        value[i - 1] = digit::div(remainder, value[i - 1], step.power, remainder);
+                    }
+
+                    while (size > 0 && value[size - 1] == 0) {
+                        --size;
+                    }
+
+                    // The highest chunk is written without its leading zeros
+                    for (size_t i = 0; i < step.length && (size > 0 || remainder != 0); ++i) {
+                        if (current == last) {
+                            return {last, std::errc::value_too_large};
+                        }
+
+                        *current++ = c_symbols[remainder % multiplier];
+                        remainder /= multiplier;
+                    }
+                }
+
+                std::reverse(first, current);
+                return {current, std::errc()};
+            }
+
+            // Reads the longest prefix of [first, last) made of symbols of base into result of digits_number
+            // digits. Returns errc::invalid_argument if there is no symbol and errc::result_out_of_range if
+            // the value does not fit, result is unspecified in both cases
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr std::from_chars_result from_chars(const char* first, const char* last, int base,
+                                                        digit_t* result, size_t digits_number) {
+                constexpr size_t c_digit_size = digit::c_digit_size<digit_t>;
+                const char* end = first;
+
+                while (end != last && symbol_value(*end) < base) {
+                    ++end;
+                }
+
+                if (end == first) {
+                    return {first, std::errc::invalid_argument};
+                }
+
+                std::fill(result, result + digits_number, digit_t(0));
+
+                if (const size_t bits = bits_per_symbol(base); bits != 0) {
+                    // Power-of-two bases write the symbols straight into the digits, lowest first
+                    size_t position = 0;
+
+                    for (const char* current = end; current != first; position += bits) {
+                        const digit_t part = static_cast<digit_t>(symbol_value(*--current));
+
+                        if (part == 0) {
+                            continue;
+                        }
+
+                        const size_t index = position / c_digit_size;
+                        const size_t offset = position % c_digit_size;
+
+                        if (index >= digits_number) {
+                            return {end, std::errc::result_out_of_range};
+                        }
+
+                        result[index] |= part << offset;
+
+                        if (offset + bits > c_digit_size) {
+                            const digit_t high_part = part >> (c_digit_size - offset);
+
+                            if (high_part != 0) {
+                                if (index + 1 >= digits_number) {
+                                    return {end, std::errc::result_out_of_range};
+                                }
+
+                                result[index + 1] |= high_part;
+                            }
+                        }
+                    }
+
+                    return {end, std::errc()};
+                }
+
+                // Other bases go by chunks: result = result * base^length + chunk, the first chunk is the
+                // shortest so that the rest are full
+                const Chunk<digit_t> step = chunk<digit_t>(base);
+                const digit_t multiplier = static_cast<digit_t>(base);
+                size_t size = 0;
+                size_t length = static_cast<size_t>(end - first) % step.length;
+
+                if (length == 0) {
+                    length = step.length;
+                }
+
+                for (const char* current = first; current != end; current += length, length = step.length) {
+                    digit_t power = 1;
+                    digit_t carry = 0;
+
+                    for (size_t i = 0; i < length; ++i) {
+                        power *= multiplier;
+                        carry = carry * multiplier + static_cast<digit_t>(symbol_value(current[i]));
+                    }
+
+                    for (size_t i = 0; i < size; ++i) {
+                        result[i] = digit::mul_add(result[i], power, digit_t(0), carry);
+                    }
+
+                    if (carry != 0) {
+                        if (size == digits_number) {
+                            return {end, std::errc::result_out_of_range};
+                        }
+
+                        result[size++] = carry;
+                    }
+                }
+
+                return {end, std::errc()};
+            }
+        }   // namespace radix
+    }       // namespace algorithm
+}   // namespace elliptic_curve_guide
+#endif
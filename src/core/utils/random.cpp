@@ -1,33 +1,149 @@
 #include "random.h"
 
+#include "utils/chacha20.h"
 #include "utils/csprng/csprng.hpp"
 
-#include <random>
+#include <algorithm>
+#include <optional>
+
+#ifdef _WIN32
+    #include <process.h>
+#else
+    #include <unistd.h>
+#endif
 
 namespace elliptic_curve_guide::algorithm::random {
-    static constexpr size_t c_size = uint_info::uint_bytes_number / sizeof(uint32_t);
+    // The system generator is opened once per thread and read once per block of this size
+    static constexpr size_t c_block_size = 4096;
 
-    uint generate_random_uint() {
-        duthomhas::csprng rng;
-        std::seed_seq sseq {228};
-        rng.seed(sseq);
-        uint result = 0;
-        std::vector<uint32_t> values = rng(std::vector<uint32_t>(c_size));
-
-        for (size_t i = 0; i < c_size; ++i) {
-            result <<= 32;
-            result += values[i];
+    // The id of the current process, a forked child gets a new one
+    static long process_id() {
+#ifdef _WIN32
+        return static_cast<long>(_getpid());
+#else
+        return static_cast<long>(getpid());
+#endif
+    }
+
+    // Zeros that the compiler may not remove as dead stores
+    static void wipe(uint8_t* bytes, size_t size) {
+        volatile uint8_t* const volatile_bytes = bytes;
+
+        for (size_t i = 0; i < size; ++i) {
+            volatile_bytes[i] = 0;
         }
+    }
+
+    namespace {
+        class Generator {
+        public:
+            Generator() = default;
+            Generator(const Generator&) = delete;
+
+            ~Generator() {
+                wipe(m_block.data(), c_block_size);
+            }
+
+            // Bytes are zeroed in the block as soon as they are handed out. A forked child would hand out the
+            // same bytes of the system generator as its parent, so it drops them and reads a block of its own
+            void generate(std::span<uint8_t> bytes) {
+                if (!m_chacha20 && m_process_id != process_id()) {
+                    discard();
+                }
+
+                while (!bytes.empty()) {
+                    if (m_position == c_block_size) {
+                        refill();
+                    }
+
+                    const size_t size = std::min(bytes.size(), c_block_size - m_position);
+                    std::copy_n(m_block.begin() + m_position, size, bytes.begin());
+                    wipe(m_block.data() + m_position, size);
+                    m_position += size;
+                    bytes = bytes.subspan(size);
+                }
+            }
+
+            // The seed is the key, the nonce is zero
+            void use_deterministic(uint64_t seed) {
+                const ChaCha20::Key key = {static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32)};
+                m_chacha20.emplace(key, ChaCha20::Nonce {});
+                discard();
+            }
+
+            void use_system() {
+                m_chacha20.reset();
+                discard();
+            }
+
+        private:
+            void discard() {
+                wipe(m_block.data() + m_position, c_block_size - m_position);
+                m_position = c_block_size;
+            }
 
+            void refill() {
+                if (m_chacha20) {
+                    for (size_t i = 0; i < c_block_size; i += ChaCha20::c_block_size) {
+                        const std::span<uint8_t, ChaCha20::c_block_size> block(m_block.data() + i,
+                                                                               ChaCha20::c_block_size);
+                        m_chacha20->generate(block);
+                    }
+                } else {
+                    if (!m_system) {
+                        m_system.emplace();
+                    }
+
+                    (*m_system)(m_block.data(), c_block_size);
+                    m_process_id = process_id();
+                }
+
+                m_position = 0;
+            }
+
+            std::array<uint8_t, c_block_size> m_block;
+            size_t m_position = c_block_size;
+            long m_process_id = 0;
+            std::optional<duthomhas::csprng> m_system;
+            std::optional<ChaCha20> m_chacha20;
+        };
+    }   // namespace
+
+    static Generator& generator() {
+        thread_local Generator result;
+        return result;
+    }
+
+    void generate_random_bytes(std::span<uint8_t> bytes) {
+        generator().generate(bytes);
+    }
+
+    void use_deterministic_generator(uint64_t seed) {
+        generator().use_deterministic(seed);
+    }
+
+    void use_system_generator() {
+        generator().use_system();
+    }
+
+    uint generate_random_uint() {
+        std::array<uint8_t, uint_info::uint_bytes_number> bytes;
+        generate_random_bytes(bytes);
+#ifdef ECG_USE_BOOST
+        uint result;
+        boost::multiprecision::import_bits(result, bytes.begin(), bytes.end(), 8, false);
         return result;
+#else
+        return uint::from_bytes(bytes);
+#endif
     }
 
     uint generate_random_uint_modulo(const uint& modulus) {
-        return generate_random_uint() % modulus;
+        return generate_random_uint_in_range<uint>(0, modulus);
     }
 
     uint generate_random_non_zero_uint_modulo(const uint& modulus) {
-        return generate_random_uint_modulo(modulus - 1) + 1;
+        return generate_random_uint_in_range<uint>(1, modulus);
     }
 
     field::FieldElement generate_random_field_element(const field::Field& field) {
@@ -1,17 +1,80 @@
 #ifndef ECG_RANDOM_H
 #define ECG_RANDOM_H
 
+#include "bitsize.h"
 #include "field.h"
 #include "uint.h"
 
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <span>
+
 namespace elliptic_curve_guide {
     namespace algorithm {
         namespace random {
+            // Random bytes of the generator of the calling thread. It reads the system generator in large
+            // blocks, or after use_deterministic_generator(seed) it is the ChaCha20 stream of the seed, which
+            // repeats the same values in every run, e.g. for benchmarks, and must never make keys
+            void generate_random_bytes(std::span<uint8_t> bytes);
+            void use_deterministic_generator(uint64_t seed);
+            void use_system_generator();
+
+            // A value in [lower, upper) by rejection: values of the bit length of upper are drawn until one
+            // is in the range, fewer than two draws on average for lower of 0 or 1 and without the bias of a
+            // reduction
+            template<typename T>
+            T generate_random_uint_in_range(const T& lower, const T& upper) {
+                assert(lower < upper && "generate_random_uint_in_range : range must not be empty");
+                const size_t bits = actual_bit_size(upper);
+                std::array<uint8_t, uint_traits<T>::bits / 8> buffer;
+                const std::span<uint8_t> bytes(buffer.data(), (bits + 7) / 8);
+
+                for (;;) {
+                    generate_random_bytes(bytes);
+                    bytes.back() &= static_cast<uint8_t>(0xff >> (8 * bytes.size() - bits));
+#ifdef ECG_USE_BOOST
+                    T result;
+                    boost::multiprecision::import_bits(result, bytes.begin(), bytes.end(), 8, false);
+#else
+                    const T result = T::from_bytes(bytes);
+#endif
+
+                    if (lower <= result && result < upper) {
+                        return result;
+                    }
+                }
+            }
+
             uint generate_random_uint();
             uint generate_random_uint_modulo(const uint& modulus);
             uint generate_random_non_zero_uint_modulo(const uint& modulus);
             field::FieldElement generate_random_field_element(const field::Field& field);
             field::FieldElement generate_random_non_zero_field_element(const field::Field& field);
+#ifndef ECG_USE_BOOST
+            // The same for the other widths
+            template<size_t c_bits, typename digit_t>
+            uint_t<c_bits, digit_t> generate_random_uint_modulo(const uint_t<c_bits, digit_t>& modulus) {
+                return generate_random_uint_in_range<uint_t<c_bits, digit_t>>(0, modulus);
+            }
+
+            template<size_t c_bits, typename digit_t>
+            uint_t<c_bits, digit_t>
+                generate_random_non_zero_uint_modulo(const uint_t<c_bits, digit_t>& modulus) {
+                return generate_random_uint_in_range<uint_t<c_bits, digit_t>>(1, modulus);
+            }
+
+            template<typename T>
+            field::BasicFieldElement<T> generate_random_field_element(const field::BasicField<T>& field) {
+                return field.element(generate_random_uint_modulo(field.modulus()));
+            }
+
+            template<typename T>
+            field::BasicFieldElement<T>
+                generate_random_non_zero_field_element(const field::BasicField<T>& field) {
+                return field.element(generate_random_non_zero_uint_modulo(field.modulus()));
+            }
+#endif
         }   // namespace random
     }       // namespace algorithm
 }   // namespace elliptic_curve_guide
@@ -0,0 +1,76 @@
+#ifndef ECG_REGISTRY_H
+#define ECG_REGISTRY_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace elliptic_curve_guide {
+    namespace algorithm {
+        // One Value shared by all users of an equal Key. The registry holds weak references only, so a value
+        // is freed with the last shared_ptr to it and made again by the next lookup of its key. A thread
+        // that looks up the same key as its previous lookup takes no lock
+        template<typename Key, typename Value>
+        class Registry {
+        public:
+            // make() returns a Value allocated by new and runs only when no value of the key is alive
+            template<typename Make>
+            static std::shared_ptr<Value> find_or_make(const Key& key, Make make) {
+                thread_local Key last_key = {};
+                thread_local std::weak_ptr<Value> last_value;
+
+                if (std::shared_ptr<Value> value = last_value.lock(); value && last_key == key) {
+                    return value;
+                }
+
+                std::shared_ptr<Value> value;
+
+                {
+                    State& state = get_state();
+                    const std::lock_guard lock(state.mutex);
+                    std::weak_ptr<Value>& entry = state.values[key];
+                    value = entry.lock();
+
+                    if (!value) {
+                        value = std::shared_ptr<Value>(make(), [key](Value* released) {
+                            erase(key);
+                            delete released;
+                        });
+
+                        entry = value;
+                    }
+                }
+
+                last_key = key;
+                last_value = value;
+                return value;
+            }
+
+        private:
+            struct State {
+                std::mutex mutex;
+                std::map<Key, std::weak_ptr<Value>> values;
+            };
+
+            // Made by the first lookup, so it outlives every value, even those held by static objects
+            static State& get_state() {
+                static State state;
+                return state;
+            }
+
+            // Another thread may have made a new value of the key after the last reference to the old one
+            // was dropped, that entry is kept
+            static void erase(const Key& key) {
+                State& state = get_state();
+                const std::lock_guard lock(state.mutex);
+                const auto it = state.values.find(key);
+
+                if (it != state.values.end() && it->second.expired()) {
+                    state.values.erase(it);
+                }
+            }
+        };
+    }   // namespace algorithm
+}   // namespace elliptic_curve_guide
+
+#endif
@@ -38,9 +38,9 @@ namespace elliptic_curve_guide::endomorphism {
             const polynomial::Poly& inverse_denominator = gcd_result.value_multiplier;
         }
 
-        RingElement r = F.element(3) * RingElement::pow(end.m_a_x, 2) + R.element(Poly(F, {A}));
+        RingElement r = F.element(3) * RingElement::square(end.m_a_x) + R.element(Poly(F, {A}));
         r *= R.element(inverse_denominator);
-        RingElement a = RingElement::pow(r, 2) * curve_function - end.m_a_x * F.element(2);
+        RingElement a = RingElement::square(r) * curve_function - end.m_a_x * F.element(2);
         RingElement b = r * (end.m_a_x - a) - end.m_b_x;
         End result(a, b, end.m_info);
         return result;
@@ -77,7 +77,7 @@ namespace elliptic_curve_guide::endomorphism {
         }
 
         RingElement r = (lhs.m_b_x - rhs.m_b_x) * R.element(inverse_denominator);
-        RingElement a = RingElement::pow(r, 2) * curve_function - lhs.m_a_x - rhs.m_a_x;
+        RingElement a = RingElement::square(r) * curve_function - lhs.m_a_x - rhs.m_a_x;
         RingElement b = r * (lhs.m_a_x - a) - lhs.m_b_x;
         End result(a, b, lhs.m_info);
         return result;
@@ -1,9 +1,68 @@
 #include "polynomial.h"
 
 #include "ring.h"
+#include "utils/bitsize.h"
 #include "utils/fast-pow.h"
+#include "utils/ntt.h"
 
 namespace elliptic_curve_guide::polynomial {
+    // Both polynomials need at least this many coefficients before the NTT product beats the schoolbook one,
+    // measured over the P-256 field
+    static constexpr size_t c_ntt_threshold = 64;
+    static constexpr size_t c_word_size = 32;
+
+    // Kronecker substitution: coefficients are packed into fixed-width slots of one long integer, the slots
+    // are wide enough to hold any coefficient of the product, so a single exact integer product computes
+    // the whole convolution. Returns nothing if a product coefficient does not fit into wide_uint
+    static std::optional<Poly> multiply_by_ntt(const Poly& lhs, const Poly& rhs) {
+        const field::Field& F = lhs.get_field();
+        const uint& p = F.modulus();
+        const size_t lhs_len = lhs.degree() + 1;
+        const size_t rhs_len = rhs.degree() + 1;
+
+        const size_t coef_bits = algorithm::actual_bit_size(p);
+        const size_t slot_bits = 2 * coef_bits + std::bit_width(std::min(lhs_len, rhs_len));
+        const size_t slot_words = (slot_bits + c_word_size - 1) / c_word_size;
+
+        if (slot_words * c_word_size > 2 * uint_info::uint_bits_number) {
+            return std::nullopt;
+        }
+
+        const auto pack = [&](const Poly& poly, size_t len) {
+            std::vector<uint32_t> result(len * slot_words, 0);
+
+            for (size_t i = 0; i < len; ++i) {
+                uint value = poly[i].value();
+
+                for (size_t j = i * slot_words; value != 0; ++j) {
+                    result[j] = value.convert_to<uint32_t>();
+                    value >>= c_word_size;
+                }
+            }
+
+            return result;
+        };
+
+        const std::vector<uint32_t> product =
+            algorithm::number_theoretic_transform::multiply(pack(lhs, lhs_len), pack(rhs, rhs_len));
+        const wide_uint modulus = p;
+        std::vector<field::FieldElement> coeffs;
+        coeffs.reserve(lhs_len + rhs_len - 1);
+
+        for (size_t i = 0; i + 1 < lhs_len + rhs_len; ++i) {
+            wide_uint value = 0;
+
+            for (size_t j = slot_words; j > 0; --j) {
+                value <<= c_word_size;
+                value |= wide_uint(product[i * slot_words + j - 1]);
+            }
+
+            coeffs.emplace_back(F.element(uint(value % modulus)));
+        }
+
+        return Poly(F, std::move(coeffs));
+    }
+
     Poly Poly::pow(const Poly& poly, const uint& power) {
         if (power == 0) {
             return Poly(poly.get_field(), {1});
@@ -15,6 +74,38 @@ namespace elliptic_curve_guide::polynomial {
         return result;
     }
 
+    Poly Poly::square(const Poly& poly) {
+        const Poly::Field& F = poly.get_field();
+
+        if (poly.len() >= c_ntt_threshold) {
+            if (std::optional<Poly> result = multiply_by_ntt(poly, poly); result.has_value()) {
+                return std::move(result.value());
+            }
+        }
+
+        size_t degree = 2 * poly.degree();
+        Poly result(F);
+        result.m_coeffs.resize(degree + 1, F.element(0));
+
+        for (size_t i = 0; i < poly.len(); ++i) {
+            for (size_t j = i + 1; j < poly.len(); ++j) {
+                result[i + j] += poly[i] * poly[j];
+            }
+        }
+
+        for (auto& coeff : result.m_coeffs) {
+            coeff += coeff;
+        }
+
+        for (size_t i = 0; i < poly.len(); ++i) {
+            result[2 * i] += Element::square(poly[i]);
+        }
+
+        result.clean();
+        assert(result.is_valid() && "Poly::square : invalid representation of polynomial");
+        return result;
+    }
+
     Poly Poly::compose(const Poly& outside_poly, const Poly& inside_poly) {
         Poly result(outside_poly.get_field(), {outside_poly[0]});
 
@@ -114,6 +205,12 @@ namespace elliptic_curve_guide::polynomial {
     Poly operator*(const Poly& lhs, const Poly& rhs) {
         const Poly::Field& F = lhs.get_field();
 
+        if (std::min(lhs.len(), rhs.len()) >= c_ntt_threshold) {
+            if (std::optional<Poly> result = multiply_by_ntt(lhs, rhs); result.has_value()) {
+                return std::move(result.value());
+            }
+        }
+
         size_t degree = lhs.degree() + rhs.degree();
         Poly result(F);
         result.m_coeffs.resize(degree + 1, F.element(0));
@@ -211,9 +308,26 @@ namespace elliptic_curve_guide::polynomial {
     Poly& Poly::operator%=(const Poly& other) {
         assert(other.degree() > 0 && "Poly::operator%= : invalid modulus");
 
-        while (degree() >= other.degree()) {
-            Element factor = top_coef() / other.top_coef();
-            *this -= increase_degree_by(other * factor, degree() - other.degree());
+        const size_t other_degree = other.degree();
+
+        if (degree() >= other_degree) {
+            // The top coefficient of the modulus is inverted once, every step is then a single multiplication
+            const Element top_inverse = Element::inverse(other.top_coef());
+
+            for (size_t pos = degree(); pos >= other_degree; --pos) {
+                if (!m_coeffs[pos].is_invertible()) {
+                    continue;
+                }
+
+                const Element factor = m_coeffs[pos] * top_inverse;
+                const size_t shift = pos - other_degree;
+
+                for (size_t i = 0; i < other_degree; ++i) {
+                    m_coeffs[shift + i] -= other.m_coeffs[i] * factor;
+                }
+            }
+
+            m_coeffs.resize(other_degree, m_field.element(0));
         }
 
         clean();
@@ -332,16 +446,17 @@ namespace elliptic_curve_guide::algorithm {
 
         Poly quotient(F, {1});
         Poly remainder = lhs;
+        const Element top_inverse = Element::inverse(rhs.top_coef());
 
         size_t degree_delta = remainder.degree() - rhs_degree;
         quotient.increase_degree_by(degree_delta);
-        Element k = remainder.top_coef() / rhs.top_coef();
+        Element k = remainder.top_coef() * top_inverse;
         remainder -= k * Poly::increase_degree_by(rhs, degree_delta);
         quotient[degree_delta] = k;
 
         while (remainder.degree() >= rhs_degree) {
             degree_delta = remainder.degree() - rhs_degree;
-            k = remainder.top_coef() / rhs.top_coef();
+            k = remainder.top_coef() * top_inverse;
             remainder -= k * Poly::increase_degree_by(rhs, degree_delta);
             quotient[degree_delta] = k;
         }
@@ -13,6 +13,7 @@ namespace elliptic_curve_guide {
 
         public:
             static Poly pow(const Poly& poly, const uint& power);
+            static Poly square(const Poly& poly);
             static Poly compose(const Poly& outside_poly, const Poly& inside_poly);
             static Poly increase_degree_by(const Poly& poly, size_t shift);
             static Poly get_x_power_n(const Field& field, size_t n);
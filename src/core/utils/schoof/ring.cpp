@@ -14,6 +14,10 @@ namespace elliptic_curve_guide::ring {
         return algorithm::fast_pow<RingElement>(element, power);
     }
 
+    RingElement RingElement::square(const RingElement& element) {
+        return RingElement(Poly::square(element.m_value), element.m_modulus);
+    }
+
     RingElement RingElement::compose(const RingElement& outside_element, const RingElement& inside_element) {
         RingElement result(Poly(outside_element.get_field(), {outside_element.m_value[0]}),
                            outside_element.m_modulus);
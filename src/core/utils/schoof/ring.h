@@ -15,6 +15,7 @@ namespace elliptic_curve_guide {
 
         public:
             static RingElement pow(const RingElement& element, const uint& power);
+            static RingElement square(const RingElement& element);
             static RingElement compose(const RingElement& outside_element, const RingElement& inside_element);
 
             friend RingElement operator+(const RingElement& lhs, const RingElement& rhs);
@@ -18,8 +18,8 @@ namespace elliptic_curve_guide::algorithm::schoof {
 
         const Element& a = curve_poly[1];
         const Element& b = curve_poly[0];
-        const Element a_squared = Element::pow(a, 2);
-        const Element b_squared = Element::pow(b, 2);
+        const Element a_squared = Element::square(a);
+        const Element b_squared = Element::square(b);
         auto curve_poly_ptr = std::make_shared<const Poly>(curve_poly);
 
         DivisionPoly psi_0 = {Poly(field, {0}), curve_poly_ptr, 0};
@@ -0,0 +1,188 @@
+#ifndef ECG_SHA256_H
+#define ECG_SHA256_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace elliptic_curve_guide {
+    namespace algorithm {
+        // SHA-256 of FIPS 180-4: bytes are taken by update in any pieces, finalize pads the message and
+        // returns its digest, after that the object must not be used
+        class Sha256 {
+        public:
+            static constexpr size_t c_digest_size = 32;
+            static constexpr size_t c_block_size = 64;
+
+            using Digest = std::array<uint8_t, c_digest_size>;
+
+            static constexpr Digest hash(std::span<const uint8_t> message) {
+                Sha256 result;
+                result.update(message);
+                return result.finalize();
+            }
+
+            constexpr Sha256& update(std::span<const uint8_t> bytes) {
+                for (const uint8_t byte : bytes) {
+                    m_block[m_block_size++] = byte;
+
+                    if (m_block_size == c_block_size) {
+                        compress();
+                    }
+                }
+
+                m_length += bytes.size();
+                return *this;
+            }
+
+            // A one bit, zeros up to 56 bytes modulo a block and the length in bits in big-endian order
+            constexpr Digest finalize() {
+                const uint64_t bits = m_length * 8;
+                m_block[m_block_size++] = 0x80;
+
+                if (m_block_size > c_block_size - 8) {
+                    while (m_block_size < c_block_size) {
+                        m_block[m_block_size++] = 0;
+                    }
+
+                    compress();
+                }
+
+                while (m_block_size < c_block_size - 8) {
+                    m_block[m_block_size++] = 0;
+                }
+
+                for (size_t i = 0; i < 8; ++i) {
+                    m_block[m_block_size++] = static_cast<uint8_t>(bits >> (56 - 8 * i));
+                }
+
+                compress();
+                Digest result;
+
+                for (size_t i = 0; i < m_state.size(); ++i) {
+                    for (size_t j = 0; j < 4; ++j) {
+                        result[4 * i + j] = static_cast<uint8_t>(m_state[i] >> (24 - 8 * j));
+                    }
+                }
+
+                return result;
+            }
+
+        private:
+            static constexpr std::array<uint32_t, 64> c_round_constants = {
+                0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4,
+                0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe,
+                0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f,
+                0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+                0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc,
+                0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+                0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116,
+                0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+                0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7,
+                0xc67178f2};
+
+            constexpr void compress() {
+                std::array<uint32_t, 64> w;
+
+                for (size_t i = 0; i < 16; ++i) {
+                    w[i] = 0;
+
+                    for (size_t j = 0; j < 4; ++j) {
+                        w[i] = w[i] << 8 | m_block[4 * i + j];
+                    }
+                }
+
+                for (size_t i = 16; i < 64; ++i) {
+                    const uint32_t s0 = std::rotr(w[i - 15], 7) ^ std::rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+                    const uint32_t s1 = std::rotr(w[i - 2], 17) ^ std::rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+                    w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+                }
+
+                std::array<uint32_t, 8> x = m_state;
+
+                for (size_t i = 0; i < 64; ++i) {
+                    const uint32_t s1 = std::rotr(x[4], 6) ^ std::rotr(x[4], 11) ^ std::rotr(x[4], 25);
+                    const uint32_t choice = (x[4] & x[5]) ^ (~x[4] & x[6]);
+                    const uint32_t t1 = x[7] + s1 + choice + c_round_constants[i] + w[i];
+                    const uint32_t s0 = std::rotr(x[0], 2) ^ std::rotr(x[0], 13) ^ std::rotr(x[0], 22);
+                    const uint32_t majority = (x[0] & x[1]) ^ (x[0] & x[2]) ^ (x[1] & x[2]);
+
+                    for (size_t j = 7; j > 0; --j) {
+                        x[j] = x[j - 1];
+                    }
+
+                    x[4] += t1;
+                    x[0] = t1 + s0 + majority;
+                }
+
+                for (size_t i = 0; i < m_state.size(); ++i) {
+                    m_state[i] += x[i];
+                }
+
+                m_block_size = 0;
+            }
+
+            std::array<uint32_t, 8> m_state = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                                               0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+            std::array<uint8_t, c_block_size> m_block = {};
+            size_t m_block_size = 0;
+            uint64_t m_length = 0;
+        };
+
+        // HMAC-SHA-256 of RFC 2104: a key longer than a block is hashed first
+        class HmacSha256 {
+        public:
+            using Digest = Sha256::Digest;
+
+            static constexpr Digest mac(std::span<const uint8_t> key, std::span<const uint8_t> message) {
+                HmacSha256 result(key);
+                result.update(message);
+                return result.finalize();
+            }
+
+            constexpr explicit HmacSha256(std::span<const uint8_t> key) {
+                std::array<uint8_t, Sha256::c_block_size> padded = {};
+
+                if (key.size() > Sha256::c_block_size) {
+                    const Digest digest = Sha256::hash(key);
+                    std::copy(digest.begin(), digest.end(), padded.begin());
+                } else {
+                    std::copy(key.begin(), key.end(), padded.begin());
+                }
+
+                for (uint8_t& byte : padded) {
+                    byte ^= c_inner_pad;
+                }
+
+                m_inner.update(padded);
+
+                for (uint8_t& byte : padded) {
+                    byte ^= c_inner_pad ^ c_outer_pad;
+                }
+
+                m_outer.update(padded);
+            }
+
+            constexpr HmacSha256& update(std::span<const uint8_t> bytes) {
+                m_inner.update(bytes);
+                return *this;
+            }
+
+            constexpr Digest finalize() {
+                const Digest inner = m_inner.finalize();
+                return m_outer.update(inner).finalize();
+            }
+
+        private:
+            static constexpr uint8_t c_inner_pad = 0x36;
+            static constexpr uint8_t c_outer_pad = 0x5c;
+
+            Sha256 m_inner;
+            Sha256 m_outer;
+        };
+    }   // namespace algorithm
+}   // namespace elliptic_curve_guide
+#endif
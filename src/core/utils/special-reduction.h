@@ -0,0 +1,172 @@
+#ifndef ECG_SPECIAL_REDUCTION_H
+#define ECG_SPECIAL_REDUCTION_H
+
+#include "digit-arithmetic.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace elliptic_curve_guide {
+    namespace algorithm {
+        namespace special_reduction {
+            constexpr size_t c_word_size = 32;
+
+            template<typename digit_t>
+            constexpr size_t c_words_in_digit = digit::c_digit_size<digit_t> / c_word_size;
+
+            // Returns the 32-bit word of value at index
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr int64_t word(const digit_t* value, size_t index) {
+                constexpr size_t c_words = c_words_in_digit<digit_t>;
+                return static_cast<uint32_t>(value[index / c_words] >> (index % c_words * c_word_size));
+            }
+
+            // Writes the sum of 32-bit columns of signed 64-bit values modulo p into the c_size words of
+            // result, modulus has c_size words. The carry out of the top column stands for a few multiples of
+            // p, which are added or subtracted. The result is less than 2^(32 * c_size) but may still exceed
+            // p
+            template<size_t c_size, typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr void normalize_columns(const std::array<int64_t, c_size>& columns,
+                                             const digit_t* modulus, digit_t* result) {
+                constexpr size_t c_words = c_words_in_digit<digit_t>;
+                constexpr size_t c_digits_number = c_size / c_words;
+                int64_t carry = 0;
+
+                for (size_t i = 0; i < c_digits_number; ++i) {
+                    digit_t digit = 0;
+
+                    for (size_t j = 0; j < c_words; ++j) {
+                        const int64_t column = columns[i * c_words + j] + carry;
+                        digit |= static_cast<digit_t>(static_cast<uint32_t>(column)) << (j * c_word_size);
+                        carry = column >> c_word_size;
+                    }
+
+                    result[i] = digit;
+                }
+
+                while (carry < 0) {
+                    digit_t digit_carry = 0;
+
+                    for (size_t i = 0; i < c_digits_number; ++i) {
+                        result[i] = digit::add(result[i], modulus[i], digit_carry);
+                    }
+
+                    carry += static_cast<int64_t>(digit_carry);
+                }
+
+                while (carry > 0) {
+                    digit_t borrow = 0;
+
+                    for (size_t i = 0; i < c_digits_number; ++i) {
+                        result[i] = digit::sub(result[i], modulus[i], borrow);
+                    }
+
+                    carry -= static_cast<int64_t>(borrow);
+                }
+            }
+
+            // p = 2^256 - 2^224 + 2^192 + 2^96 - 1, value has 16 words. FIPS 186-4, D.2.3: the sum
+            // T + 2 S1 + 2 S2 + S3 + S4 - D1 - D2 - D3 - D4 of the value's words, written out by columns
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr void reduce_p256(const digit_t* value, const digit_t* modulus, digit_t* result) {
+                const auto w = [value](size_t i) { return word(value, i); };
+                const std::array<int64_t, 8> columns = {
+                    w(0) + w(8) + w(9) - w(11) - w(12) - w(13) - w(14),
+                    w(1) + w(9) + w(10) - w(12) - w(13) - w(14) - w(15),
+                    w(2) + w(10) + w(11) - w(13) - w(14) - w(15),
+                    w(3) + 2 * w(11) + 2 * w(12) + w(13) - w(8) - w(9) - w(15),
+                    w(4) + 2 * w(12) + 2 * w(13) + w(14) - w(9) - w(10),
+                    w(5) + 2 * w(13) + 2 * w(14) + w(15) - w(10) - w(11),
+                    w(6) + w(13) + 3 * w(14) + 2 * w(15) - w(8) - w(9),
+                    w(7) + w(8) + 3 * w(15) - w(10) - w(11) - w(12) - w(13),
+                };
+
+                normalize_columns(columns, modulus, result);
+            }
+
+            // p = 2^384 - 2^128 - 2^96 + 2^32 - 1, value has 24 words. FIPS 186-4, D.2.4: the sum
+            // T + 2 S1 + S2 + S3 + S4 + S5 + S6 - D1 - D2 - D3 of the value's words, written out by columns
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr void reduce_p384(const digit_t* value, const digit_t* modulus, digit_t* result) {
+                const auto w = [value](size_t i) { return word(value, i); };
+                const std::array<int64_t, 12> columns = {
+                    w(0) + w(12) + w(20) + w(21) - w(23),
+                    w(1) + w(13) + w(22) + w(23) - w(12) - w(20),
+                    w(2) + w(14) + w(23) - w(13) - w(21),
+                    w(3) + w(12) + w(15) + w(20) + w(21) - w(14) - w(22) - w(23),
+                    w(4) + w(12) + w(13) + w(16) + w(20) + 2 * w(21) + w(22) - w(15) - 2 * w(23),
+                    w(5) + w(13) + w(14) + w(17) + w(21) + 2 * w(22) + w(23) - w(16),
+                    w(6) + w(14) + w(15) + w(18) + w(22) + 2 * w(23) - w(17),
+                    w(7) + w(15) + w(16) + w(19) + w(23) - w(18),
+                    w(8) + w(16) + w(17) + w(20) - w(19),
+                    w(9) + w(17) + w(18) + w(21) - w(20),
+                    w(10) + w(18) + w(19) + w(22) - w(21),
+                    w(11) + w(19) + w(20) + w(23) - w(22),
+                };
+
+                normalize_columns(columns, modulus, result);
+            }
+
+            // p = 2^bits - offset with a short offset: the part of value above bits is multiplied by offset
+            // and folded back until nothing is left there. Every fold makes the value smaller, so value of
+            // size digits is reduced in place to less than 2^bits. buffer holds size digits
+            template<typename digit_t>
+            requires concepts::is_digit<digit_t>
+            constexpr void fold_pseudo_mersenne(digit_t* value, size_t size, size_t bits,
+                                                const digit_t* offset, size_t offset_size, digit_t* buffer) {
+                constexpr size_t c_digit_size = digit::c_digit_size<digit_t>;
+                const size_t low_size = bits / c_digit_size;
+                const size_t shift = bits % c_digit_size;
+                const digit_t mask = (static_cast<digit_t>(1) << shift) - 1;
+
+                while (size > low_size) {
+                    size_t high_size = size - low_size;
+
+                    for (size_t i = 0; i < high_size; ++i) {
+                        buffer[i] = value[low_size + i] >> shift;
+
+                        if (shift != 0 && low_size + i + 1 < size) {
+                            buffer[i] |= value[low_size + i + 1] << (c_digit_size - shift);
+                        }
+                    }
+
+                    while (high_size > 0 && buffer[high_size - 1] == 0) {
+                        --high_size;
+                    }
+
+                    if (high_size == 0) {
+                        break;
+                    }
+
+                    std::fill(value + low_size + 1, value + size, digit_t(0));
+                    value[low_size] &= mask;
+
+                    for (size_t j = 0; j < offset_size; ++j) {
+                        digit_t carry = 0;
+
+                        for (size_t i = 0; i < high_size; ++i) {
+                            value[i + j] = digit::mul_add(buffer[i], offset[j], value[i + j], carry);
+                        }
+
+                        for (size_t i = high_size + j; carry != 0; ++i) {
+                            digit_t add_carry = 0;
+                            value[i] = digit::add(value[i], carry, add_carry);
+                            carry = add_carry;
+                        }
+                    }
+
+                    while (size > 0 && value[size - 1] == 0) {
+                        --size;
+                    }
+                }
+            }
+        }   // namespace special_reduction
+    }       // namespace algorithm
+}   // namespace elliptic_curve_guide
+#endif
@@ -7,26 +7,31 @@
 
 namespace elliptic_curve_guide {
     namespace algorithm {
-        // Parsing invalid string of unsigned integer is UB
-        template<typename T>
-        requires concepts::is_integral<T>
-        constexpr T parse_into_uint(const char* str) {
-            assert(str != nullptr && "parse_into got nullptr");
-
-            T value = 0;
-            uint16_t radix = 10;
-
+        // Skips 0x, 0b or 0 at the beginning of str and returns the radix it stands for, 10 without a prefix
+        constexpr int parse_radix_prefix(const char*& str) {
             if (str[0] == '0' && str[1] == 'x') {
-                radix = 16;
                 str += 2;
+                return 16;
             } else if (str[0] == '0' && str[1] == 'b') {
-                radix = 2;
                 str += 2;
+                return 2;
             } else if (str[0] == '0') {
-                radix = 8;
                 ++str;
+                return 8;
             }
 
+            return 10;
+        }
+
+        // Parsing invalid string of unsigned integer is UB
+        template<typename T>
+        requires concepts::is_integral<T>
+        constexpr T parse_into_uint(const char* str) {
+            assert(str != nullptr && "parse_into got nullptr");
+
+            T value = 0;
+            const uint16_t radix = static_cast<uint16_t>(parse_radix_prefix(str));
+
             while (*str != '\0') {
                 value *= static_cast<T>(radix);
                 uint16_t symbol_value = radix + 1;
@@ -1,6 +1,7 @@
 #ifndef ECG_WNAF_H
 #define ECG_WNAF_H
 
+#include "bitsize.h"
 #include "uint.h"
 
 namespace elliptic_curve_guide {
@@ -18,26 +19,41 @@ namespace elliptic_curve_guide {
 
         static constexpr uint16_t c_mask_modulo_2_pow_w = (1 << c_width) - 1;
 
-        static WnafForm get_wnaf(uint value) {
+        // Reads c_width-bit windows straight from the bits of value. The full-width additions and
+        // subtractions of the textbook recoding only ever touch the window and a carry into the bit right
+        // after it
+        template<typename Scalar>
+        static WnafForm get_wnaf(const Scalar& value) {
             WnafForm result;
+            const size_t bit_size = actual_bit_size(value);
+            result.reserve(bit_size + 1);
+            size_t pos = 0;
+            uint16_t carry = 0;
 
-            while (value > 0) {
-                if ((value & 0b1) == 1) {
-                    uint16_t coef_value = value.convert_to<uint16_t>() & c_mask_modulo_2_pow_w;
+            while (pos < bit_size || carry != 0) {
+                if (static_cast<uint16_t>(test_bit(value, pos)) == carry) {
+                    result.push_back({.value = 0, .is_negative = false});
+                    ++pos;
+                    continue;
+                }
 
-                    if (coef_value >= (1 << (c_width - 1))) {
-                        coef_value = (1 << c_width) - coef_value;
-                        result.push_back({.value = coef_value, .is_negative = true});
-                        value += coef_value;
-                    } else {
-                        result.push_back({.value = coef_value, .is_negative = false});
-                        value -= coef_value;
-                    }
+                uint16_t coef_value = (static_cast<uint16_t>(extract_bits(value, pos, c_width)) + carry)
+                                    & c_mask_modulo_2_pow_w;
+
+                if (coef_value >= (1 << (c_width - 1))) {
+                    coef_value = (1 << c_width) - coef_value;
+                    result.push_back({.value = coef_value, .is_negative = true});
+                    carry = 1;
                 } else {
-                    result.push_back({.value = 0, .is_negative = false});
+                    result.push_back({.value = coef_value, .is_negative = false});
+                    carry = 0;
                 }
 
-                value >>= 1;
+                pos += c_width;
+
+                if (pos < bit_size || carry != 0) {
+                    result.insert(result.end(), c_width - 1, {.value = 0, .is_negative = false});
+                }
             }
 
             return result;
@@ -45,8 +61,8 @@ namespace elliptic_curve_guide {
 
         static constexpr size_t c_k_number = static_cast<size_t>(1) << (c_width - 2);
 
-        template<typename T>
-        T wnaf_addition(T value, const uint& n) {
+        template<typename T, typename Scalar = uint>
+        T wnaf_addition(T value, const Scalar& n) {
             WnafForm wnaf_form = get_wnaf(n);
             T two_value = value + value;
             std::vector<T> k_values = {value};
@@ -2,45 +2,271 @@
 #define ECG_ECDSA_H
 
 #include "elliptic-curve.h"
+#include "utils/bitsize.h"
+#include "utils/random.h"
+#include "utils/sha256.h"
+
+#include <array>
+#include <span>
+#include <vector>
 
 namespace elliptic_curve_guide {
     namespace algorithm {
         namespace encryption {
-            class ECDSA {
-                using Field = field::Field;
-                using Element = field::FieldElement;
-                using Curve = elliptic_curve::EllipticCurve;
+            // The nonces of RFC 6979, 3.2: HMAC-DRBG with SHA-256 seeded by the private key and the message,
+            // so signing needs no random values and the same key signs the same message with the same k.
+            // message is the digest already converted to an integer, as ECDSA takes it
+            template<typename T>
+            class DeterministicNonce {
+            public:
+                DeterministicNonce(const T& private_key, const T& message, const T& n);
+
+                // The next candidate in [1, n), a rejected one is followed by another as in step h.3
+                T next();
+
+            private:
+                using Digest = Sha256::Digest;
+
+                // int2octets: value in big-endian order in as many bytes as n takes
+                std::vector<uint8_t> to_octets(const T& value) const;
+
+                // bits2int: the leftmost bits of the octets, as many as n has
+                T to_int(std::span<const uint8_t> octets) const;
+
+                Digest mac(std::span<const uint8_t> first, std::span<const uint8_t> second = {},
+                           std::span<const uint8_t> third = {}, std::span<const uint8_t> fourth = {}) const;
+
+                // K = HMAC_K(V || marker), V = HMAC_K(V)
+                void reseed(uint8_t marker);
+
+                T m_n;
+                size_t m_bits;
+                size_t m_bytes;
+                Digest m_k;
+                Digest m_v;
+                bool m_is_started = false;
+            };
+
+            // ECDSA over a curve on Field, which is a field::BasicField or a field::StaticField. Scalars
+            // modulo the order of the generator live in a field::BasicField of the same width
+            template<typename Field = field::Field>
+            class BasicECDSA {
+                using ScalarField = field::BasicField<typename Field::uint_type>;
+                using Element = typename ScalarField::Element;
+                using Curve = elliptic_curve::BasicEllipticCurve<Field>;
 
             public:
+                using uint_type = typename Field::uint_type;
                 static constexpr elliptic_curve::CoordinatesType point_type =
                     elliptic_curve::CoordinatesType::ModifiedJacobi;
-                using Point = elliptic_curve::EllipticCurvePoint<point_type>;
+                using Point = elliptic_curve::EllipticCurvePoint<point_type, Field>;
 
                 struct Keys {
                     Point public_key;
-                    uint private_key;
+                    uint_type private_key;
                 };
 
                 struct Signature {
-                    uint r;
-                    uint s;
+                    uint_type r;
+                    uint_type s;
                 };
 
-                ECDSA(const Field& field, const Curve& elliptic_curve, const Point& generator, const uint& n,
-                      const uint& h);
+                BasicECDSA(const Field& field, const Curve& elliptic_curve, const Point& generator,
+                           const uint_type& n, const uint_type& h);
 
                 Keys generate_keys() const;
-                Signature generate_signature(const uint& message, const uint& private_key) const;
-                bool is_correct_signature(const uint& message, const Point& public_key,
+                Signature generate_signature(const uint_type& message, const uint_type& private_key) const;
+
+                // Signs with the nonce of RFC 6979 instead of a random one
+                Signature generate_deterministic_signature(const uint_type& message,
+                                                           const uint_type& private_key) const;
+                bool is_correct_signature(const uint_type& message, const Point& public_key,
                                           const Signature& signature) const;
 
             private:
+                // next_nonce gives the candidates for k, which are taken until r and s are not zero
+                template<typename NonceGenerator>
+                Signature sign(const uint_type& message, const uint_type& private_key,
+                               NonceGenerator next_nonce) const;
+
                 Field m_field;
                 Curve m_elliptic_curve;
                 Point m_generator;
-                uint m_n;
-                uint m_h;
+                uint_type m_n;
+                uint_type m_h;
+                ScalarField m_scalar_field;
             };
+
+            using ECDSA = BasicECDSA<>;
+
+            template<typename Field>
+            BasicECDSA<Field>::BasicECDSA(const Field& field, const Curve& elliptic_curve,
+                                          const Point& generator, const uint_type& n, const uint_type& h) :
+                m_field(field), m_elliptic_curve(elliptic_curve), m_generator(generator), m_n(n), m_h(h),
+                m_scalar_field(n) {};
+
+            template<typename Field>
+            typename BasicECDSA<Field>::Keys BasicECDSA<Field>::generate_keys() const {
+                uint_type d = random::generate_random_non_zero_uint_modulo(m_n);
+                Point Q = d * m_generator;
+                return {.public_key = Q, .private_key = d};
+            }
+
+            template<typename T>
+            DeterministicNonce<T>::DeterministicNonce(const T& private_key, const T& message, const T& n) :
+                m_n(n), m_bits(actual_bit_size(n)), m_bytes((m_bits + 7) / 8) {
+                const std::vector<uint8_t> x = to_octets(private_key);
+                const std::vector<uint8_t> h = to_octets(message % n);
+                m_k.fill(0x00);
+                m_v.fill(0x01);
+
+                for (const uint8_t marker : {0x00, 0x01}) {
+                    m_k = mac(m_v, std::array {marker}, x, h);
+                    m_v = mac(m_v);
+                }
+            }
+
+            template<typename T>
+            T DeterministicNonce<T>::next() {
+                if (m_is_started) {
+                    reseed(0x00);
+                }
+
+                m_is_started = true;
+
+                for (;;) {
+                    std::vector<uint8_t> octets;
+
+                    while (octets.size() < m_bytes) {
+                        m_v = mac(m_v);
+                        octets.insert(octets.end(), m_v.begin(), m_v.end());
+                    }
+
+                    const T k = to_int(std::span(octets).first(m_bytes));
+
+                    if (k != 0 && k < m_n) {
+                        return k;
+                    }
+
+                    reseed(0x00);
+                }
+            }
+
+            template<typename T>
+            std::vector<uint8_t> DeterministicNonce<T>::to_octets(const T& value) const {
+                std::vector<uint8_t> result(m_bytes);
+
+                for (size_t i = 0; i < m_bytes; ++i) {
+                    result[i] = static_cast<uint8_t>(extract_bits(value, 8 * (m_bytes - 1 - i), 8));
+                }
+
+                return result;
+            }
+
+            template<typename T>
+            T DeterministicNonce<T>::to_int(std::span<const uint8_t> octets) const {
+                T result = 0;
+
+                for (const uint8_t octet : octets) {
+                    result <<= 8;
+                    result |= T(octet);
+                }
+
+                return result >> (8 * octets.size() - m_bits);
+            }
+
+            template<typename T>
+            typename DeterministicNonce<T>::Digest
+                DeterministicNonce<T>::mac(std::span<const uint8_t> first, std::span<const uint8_t> second,
+                                           std::span<const uint8_t> third,
+                                           std::span<const uint8_t> fourth) const {
+                return HmacSha256(m_k).update(first).update(second).update(third).update(fourth).finalize();
+            }
+
+            template<typename T>
+            void DeterministicNonce<T>::reseed(uint8_t marker) {
+                m_k = mac(m_v, std::array {marker});
+                m_v = mac(m_v);
+            }
+
+            template<typename Field>
+            typename BasicECDSA<Field>::Signature BasicECDSA<Field>::generate_signature(
+                const uint_type& message, const uint_type& private_key) const {
+                return sign(message, private_key,
+                            [this] { return random::generate_random_non_zero_uint_modulo(m_n); });
+            }
+
+            template<typename Field>
+            typename BasicECDSA<Field>::Signature BasicECDSA<Field>::generate_deterministic_signature(
+                const uint_type& message, const uint_type& private_key) const {
+                DeterministicNonce<uint_type> nonce(private_key, message, m_n);
+                return sign(message, private_key, [&nonce] { return nonce.next(); });
+            }
+
+            template<typename Field>
+            template<typename NonceGenerator>
+            typename BasicECDSA<Field>::Signature BasicECDSA<Field>::sign(const uint_type& message,
+                                                                          const uint_type& private_key,
+                                                                          NonceGenerator next_nonce) const {
+                const ScalarField& F = m_scalar_field;
+
+                for (;;) {
+                    const Element k = F.element(next_nonce());
+
+                    const Point P = k * m_generator;
+                    const uint_type r = P.get_x().value();
+
+                    if (r == 0) {
+                        continue;
+                    }
+
+                    const Element edr = F.element(message) + F.element(private_key) * F.element(r);
+                    const uint_type s = (Element::inverse(k) * edr).value();
+
+                    if (s == 0) {
+                        continue;
+                    }
+
+                    return {.r = r, .s = s};
+                }
+
+                return {};
+            }
+
+            template<typename Field>
+            bool BasicECDSA<Field>::is_correct_signature(const uint_type& message, const Point& public_key,
+                                                         const Signature& signature) const {
+                const uint_type& r = signature.r;
+                const uint_type& s = signature.s;
+
+                if (r == 0 || s == 0) {
+                    return false;
+                }
+
+                if (r >= m_n || s >= m_n) {
+                    return false;
+                }
+
+                const ScalarField& F = m_scalar_field;
+                const Element w = Element::inverse(F.element(s));
+                const Element u1 = F.element(message) * w;
+                const Element u2 = F.element(r) * w;
+                const Point X = u1 * m_generator + u2 * public_key;
+
+                if (X.is_zero()) {
+                    return false;
+                }
+
+                const uint_type v = X.get_x().value();
+                return v == r;
+            }
+
+            extern template class BasicECDSA<field::Field>;
+#ifndef ECG_USE_BOOST
+            extern template class BasicECDSA<field::BasicField<uint256>>;
+            extern template class BasicECDSA<field::BasicField<uint384>>;
+            extern template class BasicECDSA<field::BasicField<uint576>>;
+#endif
         }   // namespace encryption
     }       // namespace algorithm
 }   // namespace elliptic_curve_guide
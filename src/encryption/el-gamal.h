@@ -3,20 +3,26 @@
 
 #include "elliptic-curve.h"
 #include "functional"
+#include "utils/bitsize.h"
+#include "utils/random.h"
 
 namespace elliptic_curve_guide {
     namespace algorithm {
         namespace encryption {
-            class ElGamal {
-                using Curve = elliptic_curve::EllipticCurve;
+            // ElGamal over a curve on Field, which is a field::BasicField or a field::StaticField. Messages
+            // and keys are integers of the width of the field
+            template<typename Field = field::Field>
+            class BasicElGamal {
+                using Curve = elliptic_curve::BasicEllipticCurve<Field>;
 
             public:
+                using uint_type = typename Field::uint_type;
                 static constexpr elliptic_curve::CoordinatesType point_type =
                     elliptic_curve::CoordinatesType::ModifiedJacobi;
-                using Point = elliptic_curve::EllipticCurvePoint<point_type>;
+                using Point = elliptic_curve::EllipticCurvePoint<point_type, Field>;
 
                 struct Keys {
-                    uint private_key;
+                    uint_type private_key;
                     Point public_key;
                 };
 
@@ -37,38 +43,152 @@ namespace elliptic_curve_guide {
                 template<>
                 struct EncryptedMessage<EncryptionType::Hashed> {
                     Point generator_degree;
-                    uint message_with_salt;
+                    uint_type message_with_salt;
                 };
 
-                ElGamal(const Curve& curve, const Point& generator, const uint& generator_order);
+                BasicElGamal(const Curve& curve, const Point& generator, const uint_type& generator_order);
 
                 Keys generate_keys() const;
 
-                EncryptedMessage<EncryptionType::Standard> encrypt(const uint& message,
+                EncryptedMessage<EncryptionType::Standard> encrypt(const uint_type& message,
                                                                    const Point& public_key) const;
                 EncryptedMessage<EncryptionType::Standard> encrypt(const Point& message,
                                                                    const Point& public_key) const;
                 EncryptedMessage<EncryptionType::Hashed>
-                    encrypt(const uint& message,
+                    encrypt(const uint_type& message,
                             const Point& public_key,
-                            const std::function<uint(const Point&)>& hash_function) const;
+                            const std::function<uint_type(const Point&)>& hash_function) const;
 
                 Point decrypt_to_point(const EncryptedMessage<EncryptionType::Standard>& encrypted_message,
-                                       const uint& private_key) const;
-                uint decrypt_to_uint(const EncryptedMessage<EncryptionType::Standard>& encrypted_message,
-                                     const uint& private_key) const;
-                uint decrypt(const EncryptedMessage<EncryptionType::Hashed>& encrypted_message,
-                             const uint& private_key,
-                             const std::function<uint(const Point&)>& hash_function) const;
+                                       const uint_type& private_key) const;
+                uint_type decrypt_to_uint(const EncryptedMessage<EncryptionType::Standard>& encrypted_message,
+                                     const uint_type& private_key) const;
+                uint_type decrypt(const EncryptedMessage<EncryptionType::Hashed>& encrypted_message,
+                             const uint_type& private_key,
+                             const std::function<uint_type(const Point&)>& hash_function) const;
 
             private:
-                Point map_to_curve(const uint& message) const;
-                uint map_to_uint(const Point& message) const;
+                static constexpr uint_type c_full_bits = uint_type(0) - 1;
+
+                // The upper half of the bits of values modulo p
+                static uint_type zero_mask(const uint_type& p);
+
+                Point map_to_curve(const uint_type& message) const;
+                uint_type map_to_uint(const Point& message) const;
 
                 Curve m_curve;
                 Point m_generator;
-                uint m_generator_order;
+                uint_type m_generator_order;
             };
+
+            using ElGamal = BasicElGamal<>;
+
+            template<typename Field>
+            BasicElGamal<Field>::BasicElGamal(const Curve& curve, const Point& generator,
+                                              const uint_type& generator_order) :
+                m_curve(curve), m_generator(generator), m_generator_order(generator_order) {}
+
+            template<typename Field>
+            typename BasicElGamal<Field>::Keys BasicElGamal<Field>::generate_keys() const {
+                uint_type private_key = random::generate_random_non_zero_uint_modulo(m_generator_order);
+                Point public_key = private_key * m_generator;
+                return Keys {.private_key = private_key, .public_key = public_key};
+            }
+
+            template<typename Field>
+            auto BasicElGamal<Field>::encrypt(const uint_type& message, const Point& public_key) const
+                -> EncryptedMessage<EncryptionType::Standard> {
+                Point point_message = map_to_curve(message);
+                return encrypt(point_message, public_key);
+            }
+
+            template<typename Field>
+            auto BasicElGamal<Field>::encrypt(const Point& message, const Point& public_key) const
+                -> EncryptedMessage<EncryptionType::Standard> {
+                const uint_type k = random::generate_random_non_zero_uint_modulo(m_generator_order);
+                const Point generator_degree = k * m_generator;
+                const Point message_with_salt = message + k * public_key;
+                return {.generator_degree = generator_degree, .message_with_salt = message_with_salt};
+            }
+
+            template<typename Field>
+            auto BasicElGamal<Field>::encrypt(
+                const uint_type& message, const Point& public_key,
+                const std::function<uint_type(const Point&)>& hash_function) const
+                -> EncryptedMessage<EncryptionType::Hashed> {
+                const uint_type k = random::generate_random_non_zero_uint_modulo(m_generator_order);
+                const Point generator_degree = k * m_generator;
+                const uint_type message_with_salt = message ^ hash_function(k * public_key);
+                return {.generator_degree = generator_degree, .message_with_salt = message_with_salt};
+            }
+
+            template<typename Field>
+            typename BasicElGamal<Field>::Point BasicElGamal<Field>::decrypt_to_point(
+                const EncryptedMessage<EncryptionType::Standard>& encrypted_message,
+                const uint_type& private_key) const {
+                return encrypted_message.message_with_salt - private_key * encrypted_message.generator_degree;
+            }
+
+            template<typename Field>
+            typename BasicElGamal<Field>::uint_type BasicElGamal<Field>::decrypt_to_uint(
+                const EncryptedMessage<EncryptionType::Standard>& encrypted_message,
+                const uint_type& private_key) const {
+                auto M = encrypted_message.message_with_salt
+                       - private_key * encrypted_message.generator_degree;
+                return map_to_uint(M);
+            }
+
+            template<typename Field>
+            typename BasicElGamal<Field>::uint_type BasicElGamal<Field>::decrypt(
+                const EncryptedMessage<EncryptionType::Hashed>& encrypted_message,
+                const uint_type& private_key,
+                const std::function<uint_type(const Point&)>& hash_function) const {
+                return encrypted_message.message_with_salt
+                     ^ hash_function(private_key * encrypted_message.generator_degree);
+            }
+
+            template<typename Field>
+            typename BasicElGamal<Field>::uint_type BasicElGamal<Field>::zero_mask(const uint_type& p) {
+                const size_t l = actual_bit_size(p) >> 1;
+                return (c_full_bits >> l) << l;
+            }
+
+            template<typename Field>
+            typename BasicElGamal<Field>::Point
+                BasicElGamal<Field>::map_to_curve(const uint_type& message) const {
+                const Field& F = m_curve.get_field();
+                const uint_type& p = F.modulus();
+                const uint_type mask = zero_mask(p);
+
+                // Should take less than 3 iterations for large p:
+                // https://eprint.iacr.org/2013/373.pdf, page 5
+                for (;;) {
+                    uint_type x = random::generate_random_uint_modulo(p);
+                    x &= mask;
+                    x |= message ^ (message & mask);
+                    auto opt = m_curve.template point_with_x_equal_to<point_type>(F.element(x));
+
+                    if (opt.has_value()) {
+                        return opt.value();
+                    }
+                }
+            }
+
+            template<typename Field>
+            typename BasicElGamal<Field>::uint_type
+                BasicElGamal<Field>::map_to_uint(const Point& message) const {
+                const uint_type mask = zero_mask(m_curve.get_field().modulus());
+                uint_type x = message.get_x().value();
+                x ^= (x & mask);
+                return x;
+            }
+
+            extern template class BasicElGamal<field::Field>;
+#ifndef ECG_USE_BOOST
+            extern template class BasicElGamal<field::BasicField<uint256>>;
+            extern template class BasicElGamal<field::BasicField<uint384>>;
+            extern template class BasicElGamal<field::BasicField<uint576>>;
+#endif
         }   // namespace encryption
     }       // namespace algorithm
 }   // namespace elliptic_curve_guide
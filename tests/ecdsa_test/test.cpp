@@ -3,7 +3,12 @@
 // clang-format on
 
 #include "ecdsa.h"
+#include "static-field.h"
 #include "utils/random.h"
+#include "utils/sha256.h"
+
+#include <string>
+#include <string_view>
 
 using namespace elliptic_curve_guide;
 using namespace field;
@@ -29,10 +34,56 @@ const uint h = "0x1";
 
 const ECDSA EC(F, E, G, n, h);
 
+using StaticP256 = StaticField<"0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff">;
+using StaticECDSA = BasicECDSA<StaticP256>;
+
+const StaticP256 SF;
+const BasicEllipticCurve<StaticP256> SE(SF.element(a.value()), SF.element(b.value()), SF);
+const StaticECDSA::Point SG =
+    SE.point<StaticECDSA::point_type>(SF.element(G_x.value()), SF.element(G_y.value())).value();
+const StaticECDSA SEC(SF, SE, SG, n, h);
+
 static constexpr uint c_message_mask = (uint(1) << 128) - 1;
 static constexpr size_t c_correctness_test_verification_n = 100;
 static constexpr size_t c_stress_test_verification_n = 1000;
 
+// Signs and verifies over a curve whose field keeps its values in T
+template<typename T>
+static void check_width_ecdsa(const T& p, const T& a, const T& b, const T& G_x, const T& G_y, const T& n) {
+    using WidthECDSA = BasicECDSA<BasicField<T>>;
+    const BasicField<T> F(p);
+    const BasicEllipticCurve<BasicField<T>> E(F.element(a), F.element(b), F);
+    const typename WidthECDSA::Point G =
+        E.template point<WidthECDSA::point_type>(F.element(G_x), F.element(G_y)).value();
+    ASSERT_TRUE((n * G).is_zero());
+
+    const WidthECDSA EC(F, E, G, n, 1);
+    const typename WidthECDSA::Keys keys = EC.generate_keys();
+
+    for (size_t i = 0; i < c_correctness_test_verification_n; ++i) {
+        const T message = generate_random_uint() & c_message_mask;
+        const typename WidthECDSA::Signature sign = EC.generate_signature(message, keys.private_key);
+        ASSERT_TRUE(EC.is_correct_signature(message, keys.public_key, sign));
+        ASSERT_FALSE(EC.is_correct_signature(message + 1, keys.public_key, sign));
+    }
+}
+
+static std::span<const uint8_t> as_bytes(std::string_view str) {
+    return {reinterpret_cast<const uint8_t*>(str.data()), str.size()};
+}
+
+// The digest as a big-endian integer, which is bits2int of RFC 6979 for a 256-bit order
+static uint to_uint(const algorithm::Sha256::Digest& digest) {
+    uint result = 0;
+
+    for (const uint8_t byte : digest) {
+        result <<= 8;
+        result |= uint(byte);
+    }
+
+    return result;
+}
+
 TEST(SimpleTest, Verification) {
     ECDSA::Keys keys = EC.generate_keys();
     uint message = "0xFFF12341ABCBFFBBBE";
@@ -57,6 +108,138 @@ TEST(CorrectnessTest, Verification) {
     }
 }
 
+TEST(CorrectnessTest, StaticFieldVerification) {
+    for (size_t i = 0; i < c_correctness_test_verification_n; ++i) {
+        StaticECDSA::Keys keys = SEC.generate_keys();
+        ECDSA::Point public_key = keys.private_key * G;
+        ASSERT_TRUE(keys.public_key.get_x().value() == public_key.get_x().value());
+        ASSERT_TRUE(keys.public_key.get_y().value() == public_key.get_y().value());
+
+        uint message = generate_random_uint() & c_message_mask;
+        StaticECDSA::Signature sign = SEC.generate_signature(message, keys.private_key);
+        ASSERT_TRUE(SEC.is_correct_signature(message, keys.public_key, sign));
+        ASSERT_TRUE(EC.is_correct_signature(message, public_key, {sign.r, sign.s}));
+        ASSERT_FALSE(SEC.is_correct_signature(message + 1, keys.public_key, sign));
+    }
+}
+
+TEST(CorrectnessTest, WidthVerification) {
+    // P-256 in 256 bits gives the same keys as over uint
+    using ECDSA256 = BasicECDSA<BasicField<uint256>>;
+    const BasicField<uint256> F256(p);
+    const BasicEllipticCurve<BasicField<uint256>> E256(F256.element(a.value()), F256.element(b.value()),
+                                                       F256);
+    const ECDSA256::Point G256 =
+        E256.point<ECDSA256::point_type>(F256.element(G_x.value()), F256.element(G_y.value())).value();
+    const ECDSA256 EC256(F256, E256, G256, n, h);
+
+    for (size_t i = 0; i < c_correctness_test_verification_n; ++i) {
+        const ECDSA256::Keys keys = EC256.generate_keys();
+        const ECDSA::Point public_key = uint(keys.private_key) * G;
+        ASSERT_TRUE(uint(keys.public_key.get_x().value()) == public_key.get_x().value());
+        ASSERT_TRUE(uint(keys.public_key.get_y().value()) == public_key.get_y().value());
+
+        const uint message = generate_random_uint() & c_message_mask;
+        const ECDSA256::Signature sign = EC256.generate_signature(message, keys.private_key);
+        ASSERT_TRUE(EC.is_correct_signature(message, public_key, {sign.r, sign.s}));
+    }
+
+    check_width_ecdsa<uint256>(p, a.value(), b.value(), G_x.value(), G_y.value(), n);
+
+    // P-384
+    check_width_ecdsa<uint384>(
+        "0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffeffffffff0000000000000000ffffffff",
+        "0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffeffffffff0000000000000000fffffffc",
+        "0xb3312fa7e23ee7e4988e056be3f82d19181d9c6efe8141120314088f5013875ac656398d8a2ed19d2a85c8edd3ec2aef",
+        "0xaa87ca22be8b05378eb1c71ef320ad746e1d3b628ba79b9859f741e082542a385502f25dbf55296c3a545e3872760ab7",
+        "0x3617de4a96262c6f5d9e98bf9292dc29f8f41dbd289a147ce9da3113b5f0b8c00a60b1ce1d7e819d7a431d7c90ea0e5f",
+        "0xffffffffffffffffffffffffffffffffffffffffffffffffc7634d81f4372ddf581a0db248b0a77aecec196accc52973");
+
+    // P-521, which does not fit into uint
+    check_width_ecdsa<uint576>(
+        "0x01ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"
+        "ffffffffffffffffffffffffffffffffffffff",
+        "0x01ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"
+        "fffffffffffffffffffffffffffffffffffffc",
+        "0x0051953eb9618e1c9a1f929a21a0b68540eea2da725b99b315f3b8b489918ef109e156193951ec7e937b1652c0bd3b"
+        "b1bf073573df883d2c34f1ef451fd46b503f00",
+        "0x00c6858e06b70404e9cd9e3ecb662395b4429c648139053fb521f828af606b4d3dbaa14b5e77efe75928fe1dc127a2"
+        "ffa8de3348b3c1856a429bf97e7e31c2e5bd66",
+        "0x011839296a789a3bc0045c8a5fb42c7d1bd998f54449579b446817afbd17273e662c97ee72995ef42640c550b9013f"
+        "ad0761353c7086a272c24088be94769fd16650",
+        "0x01fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffa51868783bf2f966b7fcc0148f7"
+        "09a5d03bb5c9b8899c47aebb6fb71e91386409");
+}
+
+TEST(CorrectnessTest, Sha256) {
+    // FIPS 180-4 examples, a message of several blocks, and the cases 2 and 6 of RFC 4231
+    ASSERT_TRUE(to_uint(algorithm::Sha256::hash(as_bytes("abc")))
+                == uint("0xba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"));
+    ASSERT_TRUE(to_uint(algorithm::Sha256::hash(as_bytes(std::string(1000, 'a'))))
+                == uint("0x41edece42d63e8d9bf515a9ba6932e1c20cbc9f5a5d134645adb5db1b9737ea3"));
+    const std::string_view question = "what do ya want for nothing?";
+    ASSERT_TRUE(to_uint(algorithm::HmacSha256::mac(as_bytes("Jefe"), as_bytes(question)))
+                == uint("0x5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843"));
+
+    const std::vector<uint8_t> long_key(131, 0xaa);
+    const std::string_view message = "Test Using Larger Than Block-Size Key - Hash Key First";
+    ASSERT_TRUE(to_uint(algorithm::HmacSha256::mac(long_key, as_bytes(message)))
+                == uint("0x60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54"));
+}
+
+TEST(CorrectnessTest, DeterministicSignature) {
+    // RFC 6979, A.2.5: P-256 with SHA-256, the same signatures over uint, StaticField and 256 bits
+    const uint x = "0xc9afa9d845ba75166b5c215767b1d6934e50c3db36e89b127b8a622b120f6721";
+    const ECDSA::Point public_key = x * G;
+    ASSERT_TRUE(public_key.get_x().value()
+                == uint("0x60fed4ba255a9d31c961eb74c6356d68c049b8923b61fa6ce669622e60f29fb6"));
+    ASSERT_TRUE(public_key.get_y().value()
+                == uint("0x7903fe1008b8bc99a41ae9e95628bc64f2f1b20c2d7e9f5177a3c294d4462299"));
+
+    using ECDSA256 = BasicECDSA<BasicField<uint256>>;
+    const BasicField<uint256> F256(p);
+    const BasicEllipticCurve<BasicField<uint256>> E256(F256.element(a.value()), F256.element(b.value()),
+                                                       F256);
+    const ECDSA256::Point G256 =
+        E256.point<ECDSA256::point_type>(F256.element(G_x.value()), F256.element(G_y.value())).value();
+    const ECDSA256 EC256(F256, E256, G256, n, h);
+
+    const std::array<std::array<const char*, 3>, 2> vectors = {{
+        {"sample", "0xefd48b2aacb6a8fd1140dd9cd45e81d69d2c877b56aaf991c34d0ea84eaf3716",
+         "0xf7cb1c942d657c41d436c7a1b6e29f65f3e900dbb9aff4064dc4ab2f843acda8"},
+        {"test", "0xf1abb023518351cd71d881567b1ea663ed3efcf6c5132b354f28d3b0b7d38367",
+         "0x019f4113742a2b14bd25926b49c649155f267e60d3814b4c0cc84250e46f0083"},
+    }};
+
+    for (const auto& [text, r, s] : vectors) {
+        const uint message = to_uint(algorithm::Sha256::hash(as_bytes(text)));
+        const ECDSA::Signature sign = EC.generate_deterministic_signature(message, x);
+        ASSERT_TRUE(sign.r == uint(r));
+        ASSERT_TRUE(sign.s == uint(s));
+        ASSERT_TRUE(EC.is_correct_signature(message, public_key, sign));
+
+        const StaticECDSA::Signature static_sign = SEC.generate_deterministic_signature(message, x);
+        ASSERT_TRUE(static_sign.r == uint(r));
+        ASSERT_TRUE(static_sign.s == uint(s));
+
+        const ECDSA256::Signature width_sign = EC256.generate_deterministic_signature(message, x);
+        ASSERT_TRUE(uint(width_sign.r) == uint(r));
+        ASSERT_TRUE(uint(width_sign.s) == uint(s));
+    }
+
+    // Random keys and messages
+    const ECDSA::Keys keys = EC.generate_keys();
+
+    for (size_t i = 0; i < c_correctness_test_verification_n; ++i) {
+        const uint message = generate_random_uint();
+        const ECDSA::Signature sign = EC.generate_deterministic_signature(message, keys.private_key);
+        const ECDSA::Signature repeated_sign = EC.generate_deterministic_signature(message, keys.private_key);
+        ASSERT_TRUE(sign.r == repeated_sign.r && sign.s == repeated_sign.s);
+        ASSERT_TRUE(EC.is_correct_signature(message, keys.public_key, sign));
+        ASSERT_FALSE(EC.is_correct_signature(message + 1, keys.public_key, sign));
+    }
+}
+
 TEST(StressTest, Verification) {
     ECDSA::Keys keys = EC.generate_keys();
 
@@ -5,6 +5,7 @@
 #include "el-gamal.h"
 #include "elliptic-curve.h"
 #include "field.h"
+#include "static-field.h"
 #include "utils/random.h"
 
 using namespace elliptic_curve_guide;
@@ -38,6 +39,15 @@ const uint n = "0xffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc6325
 const ElGamal EG(E, G, n);
 ElGamal::Keys keys = EG.generate_keys();
 
+using StaticP256 = StaticField<"0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff">;
+using StaticElGamal = BasicElGamal<StaticP256>;
+
+const StaticP256 SF;
+const BasicEllipticCurve<StaticP256> SE(SF.element(a.value()), SF.element(b.value()), SF);
+const StaticElGamal::Point SG =
+    SE.point<StaticElGamal::point_type>(SF.element(G_x.value()), SF.element(G_y.value())).value();
+const StaticElGamal SEG(SE, SG, n);
+
 static constexpr uint c_message_mask = (uint(1) << 128) - 1;
 static constexpr size_t c_correctness_test_encryption_n = 100;
 static constexpr size_t c_stress_test_encryption_n = 1000;
@@ -61,6 +71,17 @@ TEST(CorrectnessTest, Encryption) {
     }
 }
 
+TEST(CorrectnessTest, StaticFieldEncryption) {
+    StaticElGamal::Keys keys = SEG.generate_keys();
+
+    for (size_t i = 0; i < c_correctness_test_encryption_n; ++i) {
+        uint message = generate_random_uint() & c_message_mask;
+        StaticElGamal::EncryptedMessage enc = SEG.encrypt(message, keys.public_key);
+        uint decrypted_message = SEG.decrypt_to_uint(enc, keys.private_key);
+        UINT_EQ(message, decrypted_message);
+    }
+}
+
 TEST(StressTest, Encryption) {
     ElGamal::Keys keys = EG.generate_keys();
 
@@ -1,11 +1,22 @@
 // clang-format off
 #include "pch.h"
 // clang-format on
+#include "field-vector.h"
 #include "field.h"
+#include "static-field.h"
+#include "utils/chacha20.h"
+#include "utils/field_root.h"
 #include "utils/primes.h"
 #include "utils/random.h"
+#include "utils/registry.h"
 
 #include <random>
+#include <thread>
+
+#ifndef _WIN32
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
 
 using namespace elliptic_curve_guide;
 using namespace field;
@@ -41,6 +52,144 @@ static uint get_random_prime() {
     return primes::prime_number_list[pos];
 }
 
+static FieldElement generate_non_residue(const Field& f) {
+    for (;;) {
+        const FieldElement b = generate_random_field_element(f);
+
+        if (b.jacobi_symbol() == -1) {
+            return b;
+        }
+    }
+}
+
+template<StaticModulus p>
+static void check_static_field() {
+    using Element = StaticFieldElement<p>;
+    const StaticField<p> sf;
+    const Field f(sf.modulus());
+
+    for (size_t i = 0; i < c_correctness_test_n; ++i) {
+        const FieldElement a = generate_random_field_element(f);
+        const FieldElement b = generate_random_non_zero_field_element(f);
+        const Element x = sf.element(a.value());
+        const Element y = sf.element(b.value());
+        const uint power = generate_random_uint_modulo(f.modulus());
+
+        UINT_EQ((x + y).value(), (a + b).value());
+        UINT_EQ((x - y).value(), (a - b).value());
+        UINT_EQ((-x).value(), (-a).value());
+        UINT_EQ((x * y).value(), (a * b).value());
+        UINT_EQ((x / y).value(), (a / b).value());
+        UINT_EQ(Element::square(x).value(), FieldElement::square(a).value());
+        UINT_EQ(Element::cube(x).value(), FieldElement::cube(a).value());
+        UINT_EQ(Element::pow(x, power).value(), FieldElement::pow(a, power).value());
+        UINT_EQ((x << i).value(), (a << i).value());
+        ASSERT_EQ(x.jacobi_symbol(), a.jacobi_symbol());
+        ASSERT_EQ(x == y, a == b);
+        ASSERT_EQ(x < y, a < b);
+
+        typename Element::Accumulator sum(x, y);
+        sum.subtract_product(y, y).add(x).subtract(y).add_product(x, x);
+        UINT_EQ(sum.reduce().value(), (a * b - b * b + a - b + a * a).value());
+
+        const std::optional<Element> root = algorithm::find_root(Element::square(y), sf);
+        ASSERT_TRUE(root.has_value());
+        UINT_EQ(Element::square(*root).value(), FieldElement::square(b).value());
+    }
+}
+
+// Compares a field whose values are kept in T with the same field over uint
+template<typename T>
+static void check_width_field(const uint& p) {
+    using Element = BasicFieldElement<T>;
+    const BasicField<T> wf(p);
+    const Field f(p);
+    static constexpr size_t c_terms_n = 64;
+
+    for (size_t i = 0; i < c_correctness_test_n; ++i) {
+        const FieldElement a = generate_random_field_element(f);
+        const FieldElement b = generate_random_non_zero_field_element(f);
+        const Element x = wf.element(a.value());
+        const Element y = wf.element(b.value());
+        const uint power = generate_random_uint_modulo(f.modulus());
+
+        UINT_EQ(uint((x + y).value()), (a + b).value());
+        UINT_EQ(uint((x - y).value()), (a - b).value());
+        UINT_EQ(uint((-x).value()), (-a).value());
+        UINT_EQ(uint((x * y).value()), (a * b).value());
+        UINT_EQ(uint((x / y).value()), (a / b).value());
+        UINT_EQ(uint(Element::square(x).value()), FieldElement::square(a).value());
+        UINT_EQ(uint(Element::cube(x).value()), FieldElement::cube(a).value());
+        UINT_EQ(uint(Element::pow(x, T(power)).value()), FieldElement::pow(a, power).value());
+        UINT_EQ(uint((x << i).value()), (a << i).value());
+        ASSERT_EQ(x.jacobi_symbol(), a.jacobi_symbol());
+        ASSERT_EQ(x == y, a == b);
+
+        // Products of full-width values overflow the wide type after a few terms
+        typename Element::Accumulator sum(x, y);
+        FieldElement correct_sum = a * b;
+
+        for (size_t j = 0; j < c_terms_n; ++j) {
+            const FieldElement c = generate_random_field_element(f);
+            const FieldElement d = generate_random_field_element(f);
+            sum.add_product(wf.element(c.value()), wf.element(d.value())).add(wf.element(d.value()));
+            correct_sum += c * d + d;
+        }
+
+        sum.subtract_product(y, y);
+        correct_sum -= b * b;
+        UINT_EQ(uint(sum.reduce().value()), correct_sum.value());
+
+        const std::optional<Element> root = algorithm::find_root(Element::square(y), wf);
+        ASSERT_TRUE(root.has_value());
+        UINT_EQ(uint(Element::square(*root).value()), FieldElement::square(b).value());
+    }
+}
+
+// Compares the element-wise kernels of a vector with the arithmetic of its elements, sizes are not
+// multiples of the lanes and some elements are zero
+template<typename T, typename Lanes>
+static void check_field_vector(const BasicField<T>& f) {
+    using Element = BasicFieldElement<T>;
+    using Vector = BasicFieldVector<T, Lanes>;
+
+    for (const size_t size : {1, 7, 37, 100}) {
+        std::vector<Element> a;
+        std::vector<Element> b;
+
+        for (size_t i = 0; i < size; ++i) {
+            a.push_back(i % 5 == 2 ? f.element(0) : generate_random_field_element(f));
+            b.push_back(generate_random_field_element(f));
+        }
+
+        const Vector x(f, a);
+        const Vector y(f, b);
+        const std::vector<Element> sum = (x + y).elements();
+        const std::vector<Element> difference = (x - y).elements();
+        const std::vector<Element> product = (x * y).elements();
+        const std::vector<Element> square = Vector::square(x).elements();
+        Vector inverse = x;
+        inverse.batch_inverse();
+
+        ASSERT_EQ(x.size(), size);
+        ASSERT_EQ(x.elements(), a);
+
+        for (size_t i = 0; i < size; ++i) {
+            ASSERT_TRUE(x[i] == a[i]);
+            ASSERT_TRUE(sum[i] == a[i] + b[i]);
+            ASSERT_TRUE(difference[i] == a[i] - b[i]);
+            ASSERT_TRUE(product[i] == a[i] * b[i]);
+            ASSERT_TRUE(square[i] == Element::square(a[i]));
+            ASSERT_TRUE(inverse[i] == (a[i].is_invertible() ? Element::inverse(a[i]) : a[i]));
+        }
+
+        Vector z(f, size);
+        z.set(size - 1, b[0]);
+        ASSERT_TRUE(z[size - 1] == b[0]);
+        ASSERT_TRUE(z[0] == (size == 1 ? b[0] : f.element(0)));
+    }
+}
+
 // Simple tests
 TEST(SimpleTest, Creating) {
     Field f("7");
@@ -58,6 +207,14 @@ TEST(SimpleTest, Multiplication) {
     ASSERT_EQ(c, 2);
 }
 
+TEST(SimpleTest, WideModulusMultiplication) {
+    uint p = (uint(1) << 500) + 1;
+    Field f(p);
+    FieldElement a = f.element(p - 1);
+    uint c = (a * a).value();
+    ASSERT_EQ(c, 1);
+}
+
 TEST(SimpleTest, Negotiation) {
     Field f("7");
     FieldElement a = -f.element(3);
@@ -196,6 +353,62 @@ TEST(CorrectnessTest, Inversion) {
     }
 }
 
+TEST(CorrectnessTest, BatchInversion) {
+    for (size_t i = 0; i < c_correctness_test_n; ++i) {
+        uint p = get_random_prime();
+        Field f(p);
+
+        std::vector<FieldElement> elements;
+
+        for (size_t j = 0; j < i % 16; ++j) {
+            elements.push_back(j % 5 == 1 ? f.element(0) : generate_random_field_element(f));
+        }
+
+        std::vector<FieldElement> copied_inverses;
+        FieldElement::batch_inverse(elements.begin(), elements.end(), std::back_inserter(copied_inverses));
+        ASSERT_EQ(copied_inverses.size(), elements.size());
+
+        std::vector<FieldElement> inverses = elements;
+        FieldElement::batch_inverse(inverses);
+
+        for (size_t j = 0; j < elements.size(); ++j) {
+            FieldElement correct_inverse =
+                elements[j].is_invertible() ? FieldElement::inverse(elements[j]) : elements[j];
+            FIELD_EQ(inverses[j], correct_inverse);
+            FIELD_EQ(copied_inverses[j], correct_inverse);
+        }
+    }
+}
+
+TEST(CorrectnessTest, Accumulation) {
+    std::vector<uint> moduli = {
+        uint("0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff"),
+        uint("0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe"
+             "ffffffff0000000000000000ffffffff"),
+        (uint(1) << 255) - 19,
+        (uint(1) << 500) + 1,
+    };
+
+    for (size_t i = 0; i < c_correctness_test_n; ++i) {
+        moduli.push_back(get_random_prime());
+    }
+
+    for (const uint& p : moduli) {
+        Field f(p);
+        FieldElement a = generate_random_field_element(f);
+        FieldElement b = generate_random_field_element(f);
+        FieldElement c = generate_random_field_element(f);
+        FieldElement d = generate_random_field_element(f);
+        FieldElement e = generate_random_field_element(f);
+
+        FieldElement::Accumulator sum(a, b);
+        sum.subtract_product(c, d).add(e).subtract(a).add_product(d, d);
+        FieldElement my_value = sum.reduce();
+        FieldElement correct_value = a * b - c * d + e - a + d * d;
+        FIELD_EQ(my_value, correct_value);
+    }
+}
+
 TEST(CorrectnessTest, Power) {
     for (size_t i = 0; i < c_correctness_test_n; ++i) {
         uint p = get_random_prime();
@@ -219,6 +432,102 @@ TEST(CorrectnessTest, Power) {
     }
 }
 
+TEST(CorrectnessTest, PowerPlan) {
+    std::vector<uint> moduli = {
+        uint("0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff"),
+        uint("0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe"
+             "ffffffff0000000000000000ffffffff"),
+        uint("0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f"),
+    };
+
+    for (size_t i = 0; i < c_correctness_test_n; ++i) {
+        moduli.push_back(get_random_prime());
+    }
+
+    for (const uint& p : moduli) {
+        Field f(p);
+        FieldElement a = generate_random_field_element(f);
+        const uint powers[] = {0, 1, p - 2, (p + 1) >> 2, (p - 1) >> 1, generate_random_uint_modulo(p)};
+
+        for (const uint& power : powers) {
+            const algorithm::PowerPlan plan(power);
+            FIELD_EQ(FieldElement::pow(a, plan), FieldElement::pow(a, power));
+        }
+    }
+
+    // A run of ones costs one multiplication per block, as in the usual addition chain
+    const uint p = moduli.front();
+    ASSERT_LE(algorithm::PowerPlan(p - 2).cost(), 256 + 16);
+}
+
+TEST(CorrectnessTest, JacobiSymbol) {
+    for (size_t i = 0; i < c_correctness_test_n; ++i) {
+        uint p = get_random_prime();
+        Field f(p);
+        FieldElement a = generate_random_field_element(f);
+        const FieldElement euler = FieldElement::pow(a, (p - 1) >> 1);
+        const int expected = !a.is_invertible() ? 0 : (euler == f.element(1) ? 1 : -1);
+        ASSERT_EQ(a.jacobi_symbol(), expected);
+        ASSERT_EQ(FieldElement::square(a).jacobi_symbol(), a.is_invertible() ? 1 : 0);
+        ASSERT_EQ(f.element(0).jacobi_symbol(), 0);
+    }
+}
+
+TEST(CorrectnessTest, SquareRoot) {
+    // p = 3 mod 4, p = 5 mod 8, p - 1 = 2^96 * q, p - 1 = 2^16 and random primes
+    std::vector<uint> moduli = {
+        uint("0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff"),
+        uint("0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffed"),
+        uint("0xffffffffffffffffffffffffffffffff000000000000000000000001"),
+        2,
+        5,
+        17,
+        65537,
+    };
+
+    for (size_t i = 0; i < c_correctness_test_n; ++i) {
+        moduli.push_back(get_random_prime());
+    }
+
+    for (const uint& p : moduli) {
+        Field f(p);
+
+        for (size_t i = 0; i < 10; ++i) {
+            const FieldElement a = generate_random_field_element(f);
+            const FieldElement square = FieldElement::square(a);
+            const std::optional<FieldElement> root = algorithm::find_root(square, f);
+
+            if (!a.is_invertible()) {
+                ASSERT_FALSE(root.has_value());
+                continue;
+            }
+
+            ASSERT_TRUE(root.has_value());
+            FIELD_EQ(FieldElement::square(*root), square);
+
+            if (p != 2) {
+                const FieldElement nonresidue = square * generate_non_residue(f);
+                ASSERT_FALSE(algorithm::find_root(nonresidue, f).has_value());
+            }
+        }
+    }
+}
+
+TEST(CorrectnessTest, SquareAndCube) {
+    for (size_t i = 0; i < c_correctness_test_n; ++i) {
+        uint p = get_random_prime();
+        Field f(p);
+
+        FieldElement a = generate_random_field_element(f);
+        FieldElement my_square = FieldElement::square(a);
+        FieldElement correct_square = a * a;
+        FIELD_EQ(my_square, correct_square);
+        FieldElement my_cube = FieldElement::cube(a);
+        FieldElement correct_cube = a * a * a;
+        FIELD_EQ(my_cube, correct_cube);
+    }
+}
+
 TEST(CorrectnessTest, Shift) {
     for (size_t i = 0; i < c_correctness_test_n; ++i) {
         uint p = get_random_prime();
@@ -242,6 +551,250 @@ TEST(CorrectnessTest, Shift) {
     }
 }
 
+TEST(CorrectnessTest, StaticField) {
+    // P-256 and 2^255 - 19 reduce by their own kernels, P-224 and a small prime in Montgomery form
+    check_static_field<"0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff">();
+    check_static_field<"0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffed">();
+    check_static_field<"0xffffffffffffffffffffffffffffffff000000000000000000000001">();
+    check_static_field<"65537">();
+
+    // Every constant of the reduction is known at compile time
+    using F = StaticField<"0xffffffffffffffffffffffffffffffff000000000000000000000001">;
+    static_assert((F().element(5) * F().element(7)).value() == 35);
+    static_assert(F::Element::inverse(F().element(3)) * F().element(3) == F().element(1));
+
+    // P-521 is wider than uint, its values are checked against the field over uint576
+    using P521 = StaticField<"0x01ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"
+                             "ffffffffffffffffffffffffffffffffffffffffffffffffffffffff">;
+    static_assert(std::is_same_v<P521::uint_type, uint576>);
+    const P521 sf;
+    const BasicField<uint576> f(sf.modulus());
+
+    for (size_t i = 0; i < c_correctness_test_n; ++i) {
+        using Element = P521::Element;
+        const BasicFieldElement<uint576> a = generate_random_field_element(f);
+        const BasicFieldElement<uint576> b = generate_random_non_zero_field_element(f);
+        const Element x = sf.element(a.value());
+        const Element y = sf.element(b.value());
+        const uint576 power = generate_random_uint_modulo(f.modulus());
+
+        ASSERT_TRUE((x + y).value() == (a + b).value());
+        ASSERT_TRUE((x - y).value() == (a - b).value());
+        ASSERT_TRUE((x * y).value() == (a * b).value());
+        ASSERT_TRUE((x / y).value() == (a / b).value());
+        ASSERT_TRUE(Element::pow(x, power).value() == BasicFieldElement<uint576>::pow(a, power).value());
+        ASSERT_TRUE((x << i).value() == (a << i).value());
+        ASSERT_EQ(x.jacobi_symbol(), a.jacobi_symbol());
+
+        const std::optional<Element> root = algorithm::find_root(Element::square(y), sf);
+        ASSERT_TRUE(root.has_value());
+        ASSERT_TRUE(Element::square(*root) == Element::square(y));
+    }
+}
+
+TEST(CorrectnessTest, WidthField) {
+    // P-256, secp256k1 and 2^255 - 19 in 256 bits by their own kernels, the order of P-256 and P-224 in
+    // Montgomery form, and P-384 in 384 bits
+    check_width_field<uint256>(uint("0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff"));
+    check_width_field<uint256>(uint("0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f"));
+    check_width_field<uint256>((uint(1) << 255) - 19);
+    check_width_field<uint256>(uint("0xffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632551"));
+    check_width_field<uint256>(uint("0xffffffffffffffffffffffffffffffff000000000000000000000001"));
+    check_width_field<uint384>(uint("0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe"
+                                    "ffffffff0000000000000000ffffffff"));
+
+    // P-521 does not fit into uint, so its field is checked against its own arithmetic
+    const BasicField<uint576> f((uint576(1) << 521) - 1);
+    const uint576 p = f.modulus();
+
+    for (size_t i = 0; i < c_correctness_test_n; ++i) {
+        using Element = BasicFieldElement<uint576>;
+        const Element x = generate_random_field_element(f);
+        const Element y = generate_random_non_zero_field_element(f);
+
+        ASSERT_TRUE((x + y) - y == x);
+        ASSERT_TRUE((x * y) / y == x);
+        ASSERT_TRUE(Element::pow(y, p - 1) == f.element(1));
+        ASSERT_TRUE(x.value() < p);
+
+        Element::Accumulator sum(x, y);
+        Element correct_sum = x * y;
+
+        for (size_t j = 0; j < 64; ++j) {
+            const Element c = generate_random_field_element(f);
+            sum.add_product(c, y).subtract(c);
+            correct_sum += c * y - c;
+        }
+
+        ASSERT_TRUE(sum.reduce() == correct_sum);
+
+        const std::optional<Element> root = algorithm::find_root(Element::square(y), f);
+        ASSERT_TRUE(root.has_value());
+        ASSERT_TRUE(Element::square(*root) == Element::square(y));
+    }
+}
+
+TEST(CorrectnessTest, FieldVector) {
+    // P-256 and 2^255 - 19 in 256 bits, P-384 and P-521 in their own widths, and a small prime in uint, by
+    // the lanes chosen at run time, by the scalar fallback and by every extension that the machine supports
+    using namespace algorithm::lanes;
+
+    const BasicField<uint256> p256("0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff");
+    const BasicField<uint256> p25519((uint256(1) << 255) - 19);
+    const BasicField<uint384> p384("0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe"
+                                   "ffffffff0000000000000000ffffffff");
+    const BasicField<uint576> p521((uint576(1) << 521) - 1);
+    const Field small(get_random_prime());
+
+    check_field_vector<uint256, DispatchedLanes>(p256);
+    check_field_vector<uint256, DispatchedLanes>(p25519);
+    check_field_vector<uint384, DispatchedLanes>(p384);
+    check_field_vector<uint576, DispatchedLanes>(p521);
+    check_field_vector<uint, DispatchedLanes>(small);
+    check_field_vector<uint256, ScalarLanes>(p256);
+    check_field_vector<uint576, ScalarLanes>(p521);
+    check_field_vector<uint, ScalarLanes>(small);
+#ifdef ECG_HAS_X86_LANES
+    if (supported_extension() >= Extension::Avx2) {
+        check_field_vector<uint256, Avx2Lanes>(p256);
+        check_field_vector<uint576, Avx2Lanes>(p521);
+    }
+
+    if (supported_extension() >= Extension::Avx512) {
+        check_field_vector<uint256, Avx512Lanes>(p256);
+        check_field_vector<uint576, Avx512Lanes>(p521);
+    }
+#endif
+}
+
+TEST(CorrectnessTest, Registry) {
+    // A value is shared while it is held, by other threads too, and made again after its release
+    using Registry = algorithm::Registry<int, const int>;
+    size_t made = 0;
+    const auto make = [&made] {
+        ++made;
+        return new const int(42);
+    };
+
+    std::shared_ptr<const int> value = Registry::find_or_make(1, make);
+    ASSERT_EQ(Registry::find_or_make(1, make), value);
+    std::thread([&] { ASSERT_EQ(Registry::find_or_make(1, make), value); }).join();
+    ASSERT_EQ(made, 1);
+
+    ASSERT_NE(Registry::find_or_make(2, make), value);
+    ASSERT_EQ(made, 2);
+
+    const std::weak_ptr<const int> released = value;
+    value.reset();
+    ASSERT_TRUE(released.expired());
+    value = Registry::find_or_make(1, make);
+    ASSERT_EQ(made, 3);
+    ASSERT_EQ(*value, 42);
+}
+
+TEST(CorrectnessTest, ChaCha20) {
+    // The block function test vector of RFC 8439, 2.3.2
+    const algorithm::ChaCha20::Key key = {0x03020100, 0x07060504, 0x0b0a0908, 0x0f0e0d0c,
+                                          0x13121110, 0x17161514, 0x1b1a1918, 0x1f1e1d1c};
+    algorithm::ChaCha20 chacha20(key, {0x09000000, 0x4a000000, 0x00000000}, 1);
+    std::array<uint8_t, algorithm::ChaCha20::c_block_size> block;
+    chacha20.generate(block);
+
+    const std::array<uint8_t, algorithm::ChaCha20::c_block_size> correct_block = {
+        0x10, 0xf1, 0xe7, 0xe4, 0xd1, 0x3b, 0x59, 0x15, 0x50, 0x0f, 0xdd, 0x1f, 0xa3, 0x20, 0x71, 0xc4,
+        0xc7, 0xd1, 0xf4, 0xc7, 0x33, 0xc0, 0x68, 0x03, 0x04, 0x22, 0xaa, 0x9a, 0xc3, 0xd4, 0x6c, 0x4e,
+        0xd2, 0x82, 0x64, 0x46, 0x07, 0x9f, 0xaa, 0x09, 0x14, 0xc2, 0xd7, 0x05, 0xd9, 0x8b, 0x02, 0xa2,
+        0xb5, 0x12, 0x9c, 0xd1, 0xde, 0x16, 0x4e, 0xb9, 0xcb, 0xd0, 0x83, 0xe8, 0xa2, 0x50, 0x3c, 0x4e};
+    ASSERT_EQ(block, correct_block);
+}
+
+TEST(CorrectnessTest, DeterministicGenerator) {
+    const uint p = get_random_prime();
+    std::vector<uint> values;
+
+    use_deterministic_generator(42);
+
+    for (size_t i = 0; i < c_correctness_test_n; ++i) {
+        values.push_back(generate_random_uint_modulo(p));
+    }
+
+    use_deterministic_generator(42);
+
+    for (size_t i = 0; i < c_correctness_test_n; ++i) {
+        UINT_EQ(generate_random_uint_modulo(p), values[i]);
+    }
+
+    use_deterministic_generator(43);
+    const uint other = generate_random_uint();
+    use_deterministic_generator(42);
+    ASSERT_NE(generate_random_uint(), other);
+    use_system_generator();
+}
+
+#ifndef _WIN32
+TEST(CorrectnessTest, ForkedGenerator) {
+    // The block buffered before the fork must not be handed out by both processes
+    generate_random_uint();
+    int channel[2];
+    ASSERT_EQ(pipe(channel), 0);
+    const pid_t child = fork();
+    ASSERT_NE(child, -1);
+
+    if (child == 0) {
+        std::array<uint8_t, 64> bytes;
+        generate_random_bytes(bytes);
+        const bool is_written = write(channel[1], bytes.data(), bytes.size()) == ssize_t(bytes.size());
+        _exit(is_written ? 0 : 1);
+    }
+
+    std::array<uint8_t, 64> bytes;
+    std::array<uint8_t, 64> child_bytes;
+    generate_random_bytes(bytes);
+    ASSERT_EQ(read(channel[0], child_bytes.data(), child_bytes.size()), ssize_t(child_bytes.size()));
+    int status = 0;
+    waitpid(child, &status, 0);
+    close(channel[0]);
+    close(channel[1]);
+    ASSERT_NE(bytes, child_bytes);
+}
+#endif
+
+TEST(CorrectnessTest, RandomRange) {
+    // Every value of a small range is drawn, and none outside of it
+    for (const uint modulus : {1, 2, 3, 5, 17, 255, 256, 257}) {
+        const size_t size = modulus.convert_to<size_t>();
+        std::vector<size_t> counts(size);
+        std::vector<size_t> non_zero_counts(size);
+
+        for (size_t i = 0; i < 64 * size; ++i) {
+            const uint value = generate_random_uint_modulo(modulus);
+            ASSERT_TRUE(value < modulus);
+            ++counts[value.convert_to<size_t>()];
+
+            if (modulus > 1) {
+                const uint non_zero = generate_random_non_zero_uint_modulo(modulus);
+                ASSERT_TRUE(non_zero != 0 && non_zero < modulus);
+                ++non_zero_counts[non_zero.convert_to<size_t>()];
+            }
+        }
+
+        for (size_t i = 0; i < size; ++i) {
+            ASSERT_GT(counts[i], 0);
+            ASSERT_EQ(non_zero_counts[i] > 0, i > 0 && size > 1);
+        }
+    }
+
+    // The widths of P-256 and P-521
+    const uint256 p256("0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff");
+    const uint576 p521 = (uint576(1) << 521) - 1;
+
+    for (size_t i = 0; i < c_correctness_test_n; ++i) {
+        ASSERT_TRUE(generate_random_uint_modulo(p256) < p256);
+        ASSERT_TRUE(generate_random_non_zero_uint_modulo(p521) < p521);
+        ASSERT_TRUE(generate_random_non_zero_uint_modulo(p521) != 0);
+    }
+}
+
 // Stress tests
 TEST(StressTest, Addition) {
     for (size_t i = 0; i < c_primes_n; ++i) {
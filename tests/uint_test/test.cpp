@@ -2,6 +2,7 @@
 #include "pch.h"
 // clang-format on
 #include "long-arithmetic.h"
+#include "utils/jacobi-symbol.h"
 #include "utils/csprng/csprng.hpp"
 
 #include <boost/multiprecision/cpp_int.hpp>
@@ -10,6 +11,8 @@
 using boost::multiprecision::uint512_t;
 
 #include <bitset>
+#include <iomanip>
+#include <limits>
 #include <random>
 
 using namespace elliptic_curve_guide;
@@ -272,6 +275,624 @@ TEST(CorrectnessTest, Division) {
     }
 }
 
+// 64-bit digits correctness
+using wide_digit_uint = uint_t<512, uint64_t>;
+
+static uint512_t generate_random_boost_uint(std::mt19937_64& gen) {
+    uint512_t result = 0;
+    size_t digits_number = gen() % 8 + 1;
+
+    for (size_t i = 0; i < digits_number; ++i) {
+        result <<= 64;
+        result += gen() >> (gen() % 64);
+    }
+
+    return result;
+}
+
+TEST(CorrectnessTest, WideDigitConversions) {
+    std::mt19937_64 gen(42);
+
+    for (size_t i = 0; i < c_correctness_test_string_conversion_n; ++i) {
+        uint512_t boost_value = generate_random_boost_uint(gen);
+        wide_digit_uint my_value(boost_value.convert_to<std::string>().c_str());
+        ASSERT_EQ(my_value.convert_to<std::string>(), boost_value.convert_to<std::string>());
+        uint_t<512> narrow_value = my_value;
+        UINT_EQ(narrow_value, boost_value);
+        ASSERT_EQ(wide_digit_uint(narrow_value), my_value);
+    }
+}
+
+TEST(CorrectnessTest, WideDigitArithmetic) {
+    std::mt19937_64 gen(42);
+
+    for (size_t i = 0; i < c_correctness_test_arithmetic_n; ++i) {
+        uint512_t boost_left = generate_random_boost_uint(gen);
+        uint512_t boost_right = generate_random_boost_uint(gen);
+
+        if (boost_right == 0) {
+            boost_right = 1;
+        }
+
+        wide_digit_uint left = convert<uint512_t, wide_digit_uint>(boost_left);
+        wide_digit_uint right = convert<uint512_t, wide_digit_uint>(boost_right);
+        UINT_EQ(uint_t<512>(left + right), uint512_t(boost_left + boost_right));
+        UINT_EQ(uint_t<512>(left - right), uint512_t(boost_left - boost_right));
+        UINT_EQ(uint_t<512>(left * right), uint512_t(boost_left * boost_right));
+        UINT_EQ(uint_t<512>(left / right), uint512_t(boost_left / boost_right));
+        UINT_EQ(uint_t<512>(left % right), uint512_t(boost_left % boost_right));
+    }
+}
+
+TEST(CorrectnessTest, MixedWidthArithmetic) {
+    std::mt19937_64 gen(7);
+
+    for (size_t i = 0; i < c_correctness_test_arithmetic_n; ++i) {
+        uint512_t boost_left = generate_random_boost_uint(gen) << (gen() % 256);
+        uint512_t boost_right = generate_random_boost_uint(gen) >> (gen() % 256);
+
+        if (boost_right == 0) {
+            boost_right = 1;
+        }
+
+        uint_t<512> left = convert<uint512_t, uint_t<512>>(boost_left);
+        uint_t<512> right = convert<uint512_t, uint_t<512>>(boost_right);
+        UINT_EQ(uint_t<512>(left + right), uint512_t(boost_left + boost_right));
+        UINT_EQ(uint_t<512>(right - left), uint512_t(boost_right - boost_left));
+        UINT_EQ(uint_t<512>(left / right), uint512_t(boost_left / boost_right));
+        UINT_EQ(uint_t<512>(left % right), uint512_t(boost_left % boost_right));
+        ASSERT_EQ(left < right, boost_left < boost_right);
+    }
+}
+
+TEST(CorrectnessTest, DivisorDivision) {
+    std::mt19937_64 gen(11);
+
+    for (size_t i = 0; i < c_correctness_test_arithmetic_n; ++i) {
+        uint512_t boost_left = generate_random_boost_uint(gen);
+        uint512_t boost_right = generate_random_boost_uint(gen) >> (gen() % 512);
+
+        // Divisors made of all-ones digits hit the quotient estimates that have to be corrected
+        if (i % 4 == 0) {
+            boost_right = (uint512_t(1) << (gen() % 511 + 1)) - 1;
+            boost_left = boost_left | (boost_right << (gen() % 64));
+        }
+
+        if (boost_right == 0) {
+            boost_right = 1;
+        }
+
+        uint_t<512> left = convert<uint512_t, uint_t<512>>(boost_left);
+        const uint_t<512>::Divisor right(convert<uint512_t, uint_t<512>>(boost_right));
+        UINT_EQ(uint_t<512>(left / right), uint512_t(boost_left / boost_right));
+        UINT_EQ(uint_t<512>(left % right), uint512_t(boost_left % boost_right));
+
+        wide_digit_uint wide_digit_left = convert<uint512_t, wide_digit_uint>(boost_left);
+        const wide_digit_uint::Divisor wide_digit_right(convert<uint512_t, wide_digit_uint>(boost_right));
+        UINT_EQ(uint_t<512>(wide_digit_left / wide_digit_right), uint512_t(boost_left / boost_right));
+        UINT_EQ(uint_t<512>(wide_digit_left % wide_digit_right), uint512_t(boost_left % boost_right));
+    }
+}
+
+TEST(CorrectnessTest, BarrettReduction) {
+    std::mt19937_64 gen(13);
+
+    for (size_t i = 0; i < c_correctness_test_arithmetic_n; ++i) {
+        uint512_t boost_modulus = generate_random_boost_uint(gen) >> (gen() % 512);
+
+        if (i % 8 == 0) {
+            boost_modulus = uint512_t(1) << (gen() % 256);
+        }
+
+        if (boost_modulus == 0) {
+            boost_modulus = 1;
+        }
+
+        // Products of residues are the values Barrett is made for, random values also cover the fallback
+        uint512_t boost_value = generate_random_boost_uint(gen);
+
+        if (i % 2 == 0 && msb(boost_modulus) < 255) {
+            boost_value = (boost_value % boost_modulus) * (generate_random_boost_uint(gen) % boost_modulus);
+        }
+
+        const uint_t<512>::Barrett modulus(convert<uint512_t, uint_t<512>>(boost_modulus));
+        UINT_EQ(uint_t<512>(convert<uint512_t, uint_t<512>>(boost_value) % modulus),
+                uint512_t(boost_value % boost_modulus));
+
+        const wide_digit_uint::Barrett wide_digit_modulus(convert<uint512_t, wide_digit_uint>(boost_modulus));
+        UINT_EQ(uint_t<512>(convert<uint512_t, wide_digit_uint>(boost_value) % wide_digit_modulus),
+                uint512_t(boost_value % boost_modulus));
+    }
+}
+
+TEST(CorrectnessTest, MontgomeryMultiplication) {
+    std::mt19937_64 gen(17);
+
+    for (size_t i = 0; i < c_correctness_test_arithmetic_n; ++i) {
+        uint512_t boost_modulus = (generate_random_boost_uint(gen) >> (gen() % 512)) | 1;
+
+        if (i % 8 == 0) {
+            boost_modulus = std::numeric_limits<uint512_t>::max() - 2 * (gen() % 1024);
+        }
+
+        const uint512_t boost_left = generate_random_boost_uint(gen) % boost_modulus;
+        const uint512_t boost_right = generate_random_boost_uint(gen) % boost_modulus;
+        boost::multiprecision::uint1024_t boost_value;
+        boost::multiprecision::multiply(boost_value, boost_left, boost_right);
+        boost_value %= boost_modulus;
+
+        const uint_t<512>::Montgomery modulus(convert<uint512_t, uint_t<512>>(boost_modulus));
+        const uint_t<512> left = modulus.to_montgomery(convert<uint512_t, uint_t<512>>(boost_left));
+        const uint_t<512> right = modulus.to_montgomery(convert<uint512_t, uint_t<512>>(boost_right));
+        UINT_EQ(modulus.from_montgomery(modulus.multiply(left, right)), uint512_t(boost_value));
+
+        const wide_digit_uint::Montgomery wide_digit_modulus(
+            convert<uint512_t, wide_digit_uint>(boost_modulus));
+        const wide_digit_uint wide_digit_left =
+            wide_digit_modulus.to_montgomery(convert<uint512_t, wide_digit_uint>(boost_left));
+        const wide_digit_uint wide_digit_right =
+            wide_digit_modulus.to_montgomery(convert<uint512_t, wide_digit_uint>(boost_right));
+        UINT_EQ(uint_t<512>(wide_digit_modulus.from_montgomery(
+                    wide_digit_modulus.multiply(wide_digit_left, wide_digit_right))),
+                uint512_t(boost_value));
+    }
+}
+
+TEST(CorrectnessTest, SpecialModulusReduction) {
+    using boost::multiprecision::cpp_int;
+    using boost::multiprecision::uint1024_t;
+    using Form = uint_t<576>::SpecialModulus::Form;
+    std::mt19937_64 gen(19);
+
+    const std::vector<std::pair<const char*, Form>> moduli = {
+        {"0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff", Form::NistP256},
+        {"0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffeffffffff0000000000000000ffffffff",
+         Form::NistP384},
+        {"0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f", Form::PseudoMersenne},
+        {"0x7fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffed", Form::PseudoMersenne},
+        {"0x7fffffffffffffffffffffffffffffff", Form::PseudoMersenne},
+        {"0x1fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff"
+         "fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff",
+         Form::PseudoMersenne},
+    };
+
+    ASSERT_FALSE(uint_t<576>::SpecialModulus::find(
+        uint_t<576>("0xffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632551")));
+
+    for (const auto& [modulus_str, form] : moduli) {
+        const uint1024_t boost_modulus(modulus_str);
+        const auto modulus = uint_t<576>::SpecialModulus::find(uint_t<576>(modulus_str));
+        const auto wide_digit_modulus =
+            uint_t<576, uint64_t>::SpecialModulus::find(uint_t<576, uint64_t>(modulus_str));
+        ASSERT_TRUE(modulus.has_value());
+        ASSERT_TRUE(wide_digit_modulus.has_value());
+        ASSERT_EQ(modulus->form(), form);
+
+        for (size_t i = 0; i < c_correctness_test_arithmetic_n; ++i) {
+            const uint1024_t boost_left =
+                ((uint1024_t(generate_random_boost_uint(gen)) << 512) | generate_random_boost_uint(gen))
+                % boost_modulus;
+            const uint1024_t boost_right =
+                i % 4 == 0 ? boost_modulus - 1 - (gen() % 4)
+                           : uint1024_t(generate_random_boost_uint(gen)) % boost_modulus;
+            const std::string left_str = boost_left.convert_to<std::string>();
+            const std::string right_str = boost_right.convert_to<std::string>();
+            const cpp_int boost_product = cpp_int(boost_left) * boost_right % boost_modulus;
+            const cpp_int boost_square = cpp_int(boost_left) * boost_left % boost_modulus;
+            const std::string product_str = boost_product.convert_to<std::string>();
+            const std::string square_str = boost_square.convert_to<std::string>();
+
+            const uint_t<576> left(left_str.c_str());
+            ASSERT_EQ(modulus->multiply(left, uint_t<576>(right_str.c_str())).convert_to<std::string>(),
+                      product_str);
+            ASSERT_EQ(modulus->square(left).convert_to<std::string>(), square_str);
+
+            const uint_t<576, uint64_t> wide_digit_left(left_str.c_str());
+            ASSERT_EQ(wide_digit_modulus->multiply(wide_digit_left, uint_t<576, uint64_t>(right_str.c_str()))
+                          .convert_to<std::string>(),
+                      product_str);
+            ASSERT_EQ(wide_digit_modulus->square(wide_digit_left).convert_to<std::string>(), square_str);
+        }
+    }
+}
+
+TEST(CorrectnessTest, BinaryGcdInversion) {
+    std::mt19937_64 gen(23);
+
+    for (size_t i = 0; i < c_correctness_test_arithmetic_n; ++i) {
+        uint512_t boost_modulus = (generate_random_boost_uint(gen) >> (gen() % 512)) | 1;
+
+        if (i % 8 == 0) {
+            boost_modulus = std::numeric_limits<uint512_t>::max() - 2 * (gen() % 1024);
+        } else if (i % 8 == 1) {
+            boost_modulus = 3 + 2 * (gen() % 1024);
+        }
+
+        uint512_t boost_value = generate_random_boost_uint(gen) % boost_modulus;
+
+        if (i % 16 == 2) {
+            boost_value = boost_modulus - 1;
+        } else if (i % 16 == 3) {
+            boost_value = 1;
+        }
+
+        if (boost_modulus == 1 || boost::multiprecision::gcd(boost_value, boost_modulus) != 1) {
+            continue;
+        }
+
+        const uint_t<512> inverse = inverse_odd_modulo(convert<uint512_t, uint_t<512>>(boost_value),
+                                                       convert<uint512_t, uint_t<512>>(boost_modulus));
+        const wide_digit_uint wide_digit_inverse =
+            inverse_odd_modulo(convert<uint512_t, wide_digit_uint>(boost_value),
+                               convert<uint512_t, wide_digit_uint>(boost_modulus));
+        const uint512_t boost_inverse = convert<uint_t<512>, uint512_t>(inverse);
+        UINT_EQ(uint_t<512>(wide_digit_inverse), boost_inverse);
+
+        boost::multiprecision::uint1024_t boost_product;
+        boost::multiprecision::multiply(boost_product, boost_inverse, boost_value);
+        ASSERT_LT(boost_inverse, boost_modulus);
+        ASSERT_TRUE(boost_product % boost_modulus == 1);
+    }
+}
+
+TEST(CorrectnessTest, JacobiSymbol) {
+    std::mt19937_64 gen(29);
+
+    for (size_t i = 0; i < c_correctness_test_arithmetic_n; ++i) {
+        uint512_t boost_modulus = (generate_random_boost_uint(gen) >> (gen() % 512)) | 1;
+
+        if (i % 8 == 0) {
+            boost_modulus = std::numeric_limits<uint512_t>::max() - 2 * (gen() % 1024);
+        } else if (i % 8 == 1) {
+            boost_modulus = 3 + 2 * (gen() % 1024);
+        }
+
+        uint512_t boost_value = generate_random_boost_uint(gen) % boost_modulus;
+
+        if (i % 16 == 2) {
+            boost_value = 0;
+        } else if (i % 16 == 3) {
+            boost::multiprecision::uint1024_t boost_square;
+            boost::multiprecision::multiply(boost_square, boost_value, boost_value);
+            boost_value = static_cast<uint512_t>(boost_square % boost_modulus);
+        } else if (i % 16 == 4) {
+            boost_value = boost_modulus - 1;
+        }
+
+        const int expected = algorithm::binary_jacobi(boost_value, boost_modulus);
+        ASSERT_EQ(algorithm::jacobi_symbol(convert<uint512_t, uint_t<512>>(boost_value),
+                                           convert<uint512_t, uint_t<512>>(boost_modulus)),
+                  expected);
+        ASSERT_EQ(algorithm::jacobi_symbol(convert<uint512_t, wide_digit_uint>(boost_value),
+                                           convert<uint512_t, wide_digit_uint>(boost_modulus)),
+                  expected);
+
+        if (i % 16 == 3 && boost::multiprecision::gcd(boost_value, boost_modulus) == 1) {
+            ASSERT_EQ(expected, 1);
+        }
+    }
+
+    // (2 / p) = 1 exactly for p = 1, 7 mod 8, (-1 / p) = 1 exactly for p = 1 mod 4
+    for (uint32_t p = 3; p < 1000; p += 2) {
+        const int two = (p % 8 == 1 || p % 8 == 7) ? 1 : -1;
+        const int minus_one = p % 4 == 1 ? 1 : -1;
+        ASSERT_EQ(algorithm::jacobi_symbol(uint_t<512>(2), uint_t<512>(p)), two);
+        ASSERT_EQ(algorithm::jacobi_symbol(uint_t<512>(p - 1), uint_t<512>(p)), minus_one);
+    }
+}
+
+TEST(CorrectnessTest, WideMultiplication) {
+    std::mt19937_64 gen(42);
+
+    for (size_t i = 0; i < c_correctness_test_arithmetic_n; ++i) {
+        uint512_t boost_left = generate_random_boost_uint(gen);
+        uint512_t boost_right = generate_random_boost_uint(gen);
+        boost::multiprecision::uint1024_t boost_value;
+        boost::multiprecision::multiply(boost_value, boost_left, boost_right);
+
+        uint_t<1024> my_value = mul_wide(convert<uint512_t, uint_t<512>>(boost_left),
+                                         convert<uint512_t, uint_t<512>>(boost_right));
+        ASSERT_EQ(my_value.convert_to<std::string>(), boost_value.convert_to<std::string>());
+
+        wide_digit_uint wide_digit_left = convert<uint512_t, wide_digit_uint>(boost_left);
+        wide_digit_uint wide_digit_right = convert<uint512_t, wide_digit_uint>(boost_right);
+        uint_t<1024, uint64_t> my_wide_digit_value = mul_wide(wide_digit_left, wide_digit_right);
+        ASSERT_EQ(my_wide_digit_value.convert_to<std::string>(), boost_value.convert_to<std::string>());
+    }
+}
+
+TEST(CorrectnessTest, KaratsubaMultiplication) {
+    std::mt19937_64 gen(42);
+
+    for (size_t i = 0; i < c_correctness_test_arithmetic_n / 10; ++i) {
+        uint_t<4096, uint64_t> left = 0;
+        uint_t<4096, uint64_t> right = 0;
+        boost::multiprecision::cpp_int boost_left = 0;
+        boost::multiprecision::cpp_int boost_right = 0;
+        size_t left_size = gen() % 64 + 1;
+        size_t right_size = gen() % 64 + 1;
+
+        for (size_t j = 0; j < left_size; ++j) {
+            uint64_t digit = gen();
+            left = (left << 64) + digit;
+            boost_left = (boost_left << 64) + digit;
+        }
+
+        for (size_t j = 0; j < right_size; ++j) {
+            uint64_t digit = gen();
+            right = (right << 64) + digit;
+            boost_right = (boost_right << 64) + digit;
+        }
+
+        uint_t<8192, uint64_t> my_value = mul_wide(left, right);
+        boost::multiprecision::cpp_int boost_value = boost_left * boost_right;
+        ASSERT_EQ(my_value.convert_to<std::string>(), boost_value.convert_to<std::string>());
+
+        uint_t<4096, uint32_t> narrow_value = uint_t<4096, uint32_t>(left) * uint_t<4096, uint32_t>(right);
+        boost_value &= (boost::multiprecision::cpp_int(1) << 4096) - 1;
+        ASSERT_EQ(narrow_value.convert_to<std::string>(), boost_value.convert_to<std::string>());
+    }
+}
+
+TEST(CorrectnessTest, Squaring) {
+    std::mt19937_64 gen(42);
+
+    for (size_t i = 0; i < c_correctness_test_arithmetic_n; ++i) {
+        uint512_t boost_value = generate_random_boost_uint(gen);
+        boost::multiprecision::uint1024_t boost_square;
+        boost::multiprecision::multiply(boost_square, boost_value, boost_value);
+
+        uint_t<512> my_value = convert<uint512_t, uint_t<512>>(boost_value);
+        UINT_EQ(uint_t<512>::square(my_value), uint512_t(boost_value * boost_value));
+        uint_t<1024, uint64_t> my_square = square_wide(wide_digit_uint(my_value));
+        ASSERT_EQ(my_square.convert_to<std::string>(), boost_square.convert_to<std::string>());
+    }
+
+    for (size_t i = 0; i < c_correctness_test_arithmetic_n / 10; ++i) {
+        uint_t<4096, uint64_t> value = 0;
+        size_t size = gen() % 64 + 1;
+
+        for (size_t j = 0; j < size; ++j) {
+            value = (value << 64) + gen();
+        }
+
+        ASSERT_EQ(square_wide(value), mul_wide(value, value));
+    }
+}
+
+TEST(CorrectnessTest, NttMultiplication) {
+    std::mt19937 gen(42);
+    const auto to_boost = [](const std::vector<uint32_t>& words) {
+        boost::multiprecision::cpp_int result = 0;
+
+        for (size_t i = words.size(); i > 0; --i) {
+            result = (result << 32) + words[i - 1];
+        }
+
+        return result;
+    };
+
+    for (size_t i = 0; i < 100; ++i) {
+        std::vector<uint32_t> lhs(gen() % 300 + 1);
+        std::vector<uint32_t> rhs(gen() % 300 + 1);
+
+        for (auto& word : lhs) {
+            word = i % 2 == 0 ? gen() : std::numeric_limits<uint32_t>::max();
+        }
+
+        for (auto& word : rhs) {
+            word = i % 2 == 0 ? gen() : std::numeric_limits<uint32_t>::max();
+        }
+
+        std::vector<uint32_t> product = algorithm::number_theoretic_transform::multiply(lhs, rhs);
+        ASSERT_EQ(product.size(), lhs.size() + rhs.size());
+        ASSERT_EQ(to_boost(product), to_boost(lhs) * to_boost(rhs));
+    }
+
+    uint_t<131072> value = 0;
+    boost::multiprecision::cpp_int boost_value = 0;
+
+    for (size_t i = 0; i < 4096; ++i) {
+        uint32_t word = gen();
+        value = (value << 32) + word;
+        boost_value = (boost_value << 32) + word;
+    }
+
+    uint_t<262144> my_square = mul_wide(value, value);
+    boost::multiprecision::cpp_int boost_square = boost_value * boost_value;
+    ASSERT_EQ(my_square.convert_to<std::string>(), boost_square.convert_to<std::string>());
+}
+
+TEST(CorrectnessTest, ConstexprKaratsubaMultiplication) {
+    constexpr uint_t<4096, uint64_t> value = (uint_t<4096, uint64_t>(1) << 2048) - 1;
+    constexpr uint_t<4096, uint64_t> correct_value =
+        uint_t<4096, uint64_t>(1) - (uint_t<4096, uint64_t>(1) << 2049);
+    static_assert(value * value == correct_value);
+}
+
+TEST(CorrectnessTest, ConstexprMatchesRuntime) {
+    constexpr wide_digit_uint lhs = "0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff";
+    constexpr wide_digit_uint rhs = "0x5ac635d8aa3a93e7b3ebbd55769886bc651d06b0cc53b0f63bce3c3e27d2604b";
+    constexpr wide_digit_uint sum = lhs + rhs;
+    constexpr wide_digit_uint difference = rhs - lhs;
+    constexpr wide_digit_uint product = lhs * rhs;
+    constexpr wide_digit_uint quotient = product / rhs;
+    constexpr wide_digit_uint remainder = (product + sum) % lhs;
+
+    volatile size_t index = 0;
+    std::array<wide_digit_uint, 2> values = {lhs, rhs};
+    const wide_digit_uint& runtime_lhs = values[index];
+    const wide_digit_uint& runtime_rhs = values[index + 1];
+    ASSERT_EQ(runtime_lhs + runtime_rhs, sum);
+    ASSERT_EQ(runtime_rhs - runtime_lhs, difference);
+    ASSERT_EQ(runtime_lhs * runtime_rhs, product);
+    ASSERT_EQ(product / runtime_rhs, quotient);
+    ASSERT_EQ((product + sum) % runtime_lhs, remainder);
+    ASSERT_EQ(quotient, lhs);
+}
+
+TEST(CorrectnessTest, BitOperations) {
+    std::mt19937_64 gen(42);
+
+    for (size_t i = 0; i < c_correctness_test_shift_n; ++i) {
+        uint512_t boost_value = generate_random_boost_uint(gen) << (gen() % 64);
+        uint_t<512> my_value = convert<uint512_t, uint_t<512>>(boost_value);
+        wide_digit_uint wide_digit_value = my_value;
+
+        const size_t bit_length = boost_value == 0 ? 0 : boost::multiprecision::msb(boost_value) + 1;
+        const size_t countr_zero = boost_value == 0 ? 512 : boost::multiprecision::lsb(boost_value);
+        ASSERT_EQ(my_value.bit_length(), bit_length);
+        ASSERT_EQ(wide_digit_value.bit_length(), bit_length);
+        ASSERT_EQ(my_value.countr_zero(), countr_zero);
+        ASSERT_EQ(wide_digit_value.countr_zero(), countr_zero);
+
+        for (size_t pos = 0; pos < 520; ++pos) {
+            const bool bit = pos < 512 && boost::multiprecision::bit_test(boost_value, pos);
+            ASSERT_EQ(my_value.test_bit(pos), bit);
+            ASSERT_EQ(wide_digit_value.test_bit(pos), bit);
+
+            const size_t width = gen() % 33;
+            const uint512_t mask = (uint512_t(1) << width) - 1;
+            const uint32_t bits = ((boost_value >> pos) & mask).convert_to<uint32_t>();
+            ASSERT_EQ(my_value.extract_bits(pos, width), bits);
+            ASSERT_EQ(wide_digit_value.extract_bits(pos, width), bits);
+        }
+    }
+}
+
+TEST(CorrectnessTest, BytesConversion) {
+    std::mt19937_64 gen(42);
+
+    for (size_t i = 0; i < c_correctness_test_shift_n; ++i) {
+        const uint512_t boost_value = generate_random_boost_uint(gen) >> (gen() % 512);
+        const size_t size = gen() % 72;
+        std::vector<uint8_t> bytes(size);
+
+        for (size_t j = 0; j < size; ++j) {
+            bytes[j] = j < 64 ? ((boost_value >> (8 * j)) & 0xff).convert_to<uint8_t>() : 0xff;
+        }
+
+        const uint512_t mask = size < 64 ? (uint512_t(1) << (8 * size)) - 1 : ~uint512_t(0);
+        const uint512_t correct_value = boost_value & mask;
+        UINT_EQ(uint_t<512>::from_bytes(bytes), correct_value);
+        UINT_EQ(uint_t<512>(wide_digit_uint::from_bytes(bytes)), correct_value);
+    }
+}
+
+TEST(CorrectnessTest, CharsConversions) {
+    std::mt19937_64 gen(42);
+    std::array<char, 600> buffer;
+    char* first = buffer.data();
+    char* last = buffer.data() + buffer.size();
+
+    for (size_t i = 0; i < c_correctness_test_string_conversion_n; ++i) {
+        uint512_t boost_value = generate_random_boost_uint(gen);
+        uint_t<512> my_value = convert<uint512_t, uint_t<512>>(boost_value);
+        wide_digit_uint wide_digit_value = my_value;
+
+        for (int base : {10, 16, 8, 2}) {
+            std::string correct_str;
+
+            if (base == 2) {
+                correct_str = convert_to_binary(boost_value).substr(2);
+                correct_str.erase(0, std::min(correct_str.find('1'), correct_str.size() - 1));
+            } else {
+                std::stringstream ss;
+                ss << std::setbase(base) << boost_value;
+                correct_str = ss.str();
+            }
+
+            auto [ptr, ec] = to_chars(first, last, my_value, base);
+            ASSERT_EQ(ec, std::errc());
+            ASSERT_EQ(std::string(first, ptr), correct_str);
+
+            auto [wide_ptr, wide_ec] = to_chars(first, last, wide_digit_value, base);
+            ASSERT_EQ(wide_ec, std::errc());
+            ASSERT_EQ(std::string(first, wide_ptr), correct_str);
+
+            uint_t<512> parsed_value;
+            ASSERT_EQ(from_chars(first, wide_ptr, parsed_value, base).ec, std::errc());
+            ASSERT_EQ(parsed_value, my_value);
+
+            wide_digit_uint parsed_wide_digit_value;
+            ASSERT_EQ(from_chars(first, wide_ptr, parsed_wide_digit_value, base).ec, std::errc());
+            ASSERT_EQ(parsed_wide_digit_value, wide_digit_value);
+        }
+
+        for (int base : {3, 7, 32, 36}) {
+            auto [ptr, ec] = to_chars(first, last, wide_digit_value, base);
+            ASSERT_EQ(ec, std::errc());
+            uint_t<512> parsed_value;
+            ASSERT_EQ(from_chars(first, ptr, parsed_value, base).ec, std::errc());
+            ASSERT_EQ(parsed_value, my_value);
+        }
+    }
+}
+
+TEST(CorrectnessTest, CharsConversionErrors) {
+    const uint_t<512> max_value = uint_t<512>(0) - 1;
+    std::array<char, 600> buffer;
+    char* first = buffer.data();
+
+    for (int base : {10, 16, 7, 2}) {
+        auto [ptr, ec] = to_chars(first, first + buffer.size(), max_value, base);
+        ASSERT_EQ(ec, std::errc());
+        ASSERT_EQ(to_chars(first, ptr - 1, max_value, base).ec, std::errc::value_too_large);
+
+        *ptr = '0';
+        uint_t<512> value = 1;
+        auto [overflow_ptr, overflow_ec] = from_chars(first, ptr + 1, value, base);
+        ASSERT_EQ(overflow_ec, std::errc::result_out_of_range);
+        ASSERT_EQ(overflow_ptr, ptr + 1);
+        ASSERT_EQ(value, 1);
+    }
+
+    const std::string str = "123z";
+    uint_t<512> value = 1;
+    auto [ptr, ec] = from_chars(str.data(), str.data() + str.size(), value);
+    ASSERT_EQ(ec, std::errc());
+    ASSERT_EQ(ptr, str.data() + 3);
+    ASSERT_EQ(value, 123);
+    ASSERT_EQ(from_chars(str.data() + 3, str.data() + str.size(), value).ec, std::errc::invalid_argument);
+    ASSERT_EQ(value, 123);
+    ASSERT_EQ(to_chars(first, first, uint_t<512>(0)).ec, std::errc::value_too_large);
+}
+
+TEST(CorrectnessTest, HugeCharsConversion) {
+    using huge_uint = uint_t<16384, uint64_t>;
+    std::mt19937_64 gen(42);
+    std::string buffer(6000, '0');
+    char* first = buffer.data();
+
+    for (size_t i = 0; i < 10; ++i) {
+        huge_uint value;
+
+        for (size_t j = 0; j < 16384 / 64; ++j) {
+            value <<= 64;
+            value += huge_uint(gen());
+        }
+
+        value >>= gen() % 16384;
+
+        auto [ptr, ec] = to_chars(first + 100, first + buffer.size(), value);
+        ASSERT_EQ(ec, std::errc());
+
+        huge_uint parsed_value;
+        ASSERT_EQ(from_chars(first, ptr, parsed_value).ec, std::errc());
+        ASSERT_EQ(parsed_value, value);
+        ASSERT_EQ(from_chars(first + 100, ptr, parsed_value).ec, std::errc());
+        ASSERT_EQ(parsed_value, value);
+    }
+
+    auto [ptr, ec] = to_chars(first, first + buffer.size(), huge_uint(0) - 1);
+    ASSERT_EQ(ec, std::errc());
+    *ptr = '0';
+    huge_uint value;
+    ASSERT_EQ(from_chars(first, ptr + 1, value).ec, std::errc::result_out_of_range);
+    ASSERT_EQ(from_chars(first, ptr, value).ec, std::errc());
+    ASSERT_EQ(value, huge_uint(0) - 1);
+}
+
 // Timing measurements
 
 TEST(TimingTest, DecimalStringConversion) {